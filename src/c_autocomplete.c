@@ -5403,6 +5403,9 @@ autocomplete_t autocompletelist[] =
     { "bind z +zoomin",                              DOOM1AND2        },
     { "bind z +zoomout",                             DOOM1AND2        },
     { "bindlist",                                    DOOM1AND2        },
+    { "cachestats",                                  DOOM1AND2        },
+    { "capture",                                     DOOM1AND2        },
+    { "capture raw",                                 DOOM1AND2        },
     { "centerweapon ",                               DOOM1AND2        },
     { "centerweapon off",                            DOOM1AND2        },
     { "centerweapon on",                             DOOM1AND2        },
@@ -5908,6 +5911,13 @@ autocomplete_t autocompletelist[] =
     { "if melt off then ",                           DOOM1AND2        },
     { "if melt on ",                                 DOOM1AND2        },
     { "if melt on then ",                            DOOM1AND2        },
+    { "if mem_cachebudget ",                         DOOM1AND2        },
+    { "if mem_cachebudget 0 ",                       DOOM1AND2        },
+    { "if mem_cachebudget 0 then ",                  DOOM1AND2        },
+    { "if mem_cachebudget 1,024 ",                   DOOM1AND2        },
+    { "if mem_cachebudget 1,024 then ",              DOOM1AND2        },
+    { "if mem_cachebudget 64 ",                      DOOM1AND2        },
+    { "if mem_cachebudget 64 then ",                 DOOM1AND2        },
     { "if menuhighlight ",                           DOOM1AND2        },
     { "if menuhighlight off ",                       DOOM1AND2        },
     { "if menuhighlight off then ",                  DOOM1AND2        },
@@ -6027,6 +6037,11 @@ autocomplete_t autocompletelist[] =
     { "if r_brightmaps off then ",                   DOOM1AND2        },
     { "if r_brightmaps on ",                         DOOM1AND2        },
     { "if r_brightmaps on then ",                    DOOM1AND2        },
+    { "if r_columnmajor ",                           DOOM1AND2        },
+    { "if r_columnmajor off ",                       DOOM1AND2        },
+    { "if r_columnmajor off then ",                  DOOM1AND2        },
+    { "if r_columnmajor on ",                        DOOM1AND2        },
+    { "if r_columnmajor on then ",                   DOOM1AND2        },
     { "if r_corpses_color ",                         DOOM1AND2        },
     { "if r_corpses_color off ",                     DOOM1AND2        },
     { "if r_corpses_color off then ",                DOOM1AND2        },
@@ -6540,6 +6555,13 @@ autocomplete_t autocompletelist[] =
     { "if vid_screenresolution ",                    DOOM1AND2        },
     { "if vid_screenresolution desktop ",            DOOM1AND2        },
     { "if vid_screenresolution desktop then ",       DOOM1AND2        },
+    { "if vid_screenshotcompression ",               DOOM1AND2        },
+    { "if vid_screenshotcompression 0 ",             DOOM1AND2        },
+    { "if vid_screenshotcompression 0 then ",        DOOM1AND2        },
+    { "if vid_screenshotcompression 10 ",            DOOM1AND2        },
+    { "if vid_screenshotcompression 10 then ",       DOOM1AND2        },
+    { "if vid_screenshotcompression 6 ",             DOOM1AND2        },
+    { "if vid_screenshotcompression 6 then ",        DOOM1AND2        },
     { "if vid_showfps ",                             DOOM1AND2        },
     { "if vid_showfps off ",                         DOOM1AND2        },
     { "if vid_showfps off then ",                    DOOM1AND2        },
@@ -7140,6 +7162,11 @@ autocomplete_t autocompletelist[] =
     { "melt ",                                       DOOM1AND2        },
     { "melt off",                                    DOOM1AND2        },
     { "melt on",                                     DOOM1AND2        },
+    { "mem_cachebudget ",                            DOOM1AND2        },
+    { "mem_cachebudget 0",                           DOOM1AND2        },
+    { "mem_cachebudget 1,024",                       DOOM1AND2        },
+    { "mem_cachebudget 64",                          DOOM1AND2        },
+    { "memory ",                                     DOOM1AND2        },
     { "+menu",                                       DOOM1AND2        },
     { "menuhighlight ",                              DOOM1AND2        },
     { "menuhighlight off",                           DOOM1AND2        },
@@ -7631,6 +7658,9 @@ autocomplete_t autocompletelist[] =
     { "r_brightmaps ",                               DOOM1AND2        },
     { "r_brightmaps off",                            DOOM1AND2        },
     { "r_brightmaps on",                             DOOM1AND2        },
+    { "r_columnmajor ",                              DOOM1AND2        },
+    { "r_columnmajor off",                           DOOM1AND2        },
+    { "r_columnmajor on",                            DOOM1AND2        },
     { "r_corpses_color ",                            DOOM1AND2        },
     { "r_corpses_color off",                         DOOM1AND2        },
     { "r_corpses_color on",                          DOOM1AND2        },
@@ -7972,6 +8002,7 @@ autocomplete_t autocompletelist[] =
     { "reset m_pointer",                             DOOM1AND2        },
     { "reset m_sensitivity",                         DOOM1AND2        },
     { "reset melt",                                  DOOM1AND2        },
+    { "reset mem_cachebudget",                       DOOM1AND2        },
     { "reset menuhighlight",                         DOOM1AND2        },
     { "reset menushadow",                            DOOM1AND2        },
     { "reset menuspin",                              DOOM1AND2        },
@@ -7990,6 +8021,7 @@ autocomplete_t autocompletelist[] =
     { "reset r_bloodsplats_max",                     DOOM1AND2        },
     { "reset r_bloodsplats_translucency",            DOOM1AND2        },
     { "reset r_brightmaps",                          DOOM1AND2        },
+    { "reset r_columnmajor",                         DOOM1AND2        },
     { "reset r_corpses_color",                       DOOM1AND2        },
     { "reset r_corpses_gib",                         DOOM1AND2        },
     { "reset r_corpses_mirrored",                    DOOM1AND2        },
@@ -8070,6 +8102,7 @@ autocomplete_t autocompletelist[] =
     { "reset vid_scaleapi",                          DOOM1AND2        },
     { "reset vid_scalefilter",                       DOOM1AND2        },
     { "reset vid_screenresolution",                  DOOM1AND2        },
+    { "reset vid_screenshotcompression",             DOOM1AND2        },
     { "reset vid_showfps",                           DOOM1AND2        },
     { "reset vid_vsync",                             DOOM1AND2        },
     { "reset vid_widescreen",                        DOOM1AND2        },
@@ -8144,6 +8177,8 @@ autocomplete_t autocompletelist[] =
     { "resurrect unfriendly zombiemen",              DOOM1AND2        },
     { "resurrect wolfensteinss",                     DOOM2ONLY        },
     { "resurrect zombiemen",                         DOOM1AND2        },
+    { "+rewind",                                     DOOM1AND2        },
+    { "rewind ",                                     DOOM1AND2        },
     { "+right",                                      DOOM1AND2        },
     { "+rotatemode",                                 DOOM1AND2        },
     { "+run",                                        DOOM1AND2        },
@@ -8561,6 +8596,7 @@ autocomplete_t autocompletelist[] =
     { "take yellowskullkey",                         DOOM1AND2        },
     { "teleport ",                                   DOOM1AND2        },
     { "thinglist",                                   DOOM1AND2        },
+    { "thingstats",                                  DOOM1AND2        },
     { "timer ",                                      DOOM1AND2        },
     { "toggle ",                                     DOOM1AND2        },
     { "toggle alwaysrun",                            DOOM1AND2        },
@@ -8609,6 +8645,7 @@ autocomplete_t autocompletelist[] =
     { "toggle r_blood_melee",                        DOOM1AND2        },
     { "toggle r_bloodsplats_translucency",           DOOM1AND2        },
     { "toggle r_brightmaps",                         DOOM1AND2        },
+    { "toggle r_columnmajor",                        DOOM1AND2        },
     { "toggle r_corpses_color",                      DOOM1AND2        },
     { "toggle r_corpses_gib",                        DOOM1AND2        },
     { "toggle r_corpses_mirrored",                   DOOM1AND2        },
@@ -8906,6 +8943,10 @@ autocomplete_t autocompletelist[] =
     { "vid_scalefilter nearest_linear",              DOOM1AND2        },
     { "vid_screenresolution ",                       DOOM1AND2        },
     { "vid_screenresolution desktop",                DOOM1AND2        },
+    { "vid_screenshotcompression ",                  DOOM1AND2        },
+    { "vid_screenshotcompression 0",                 DOOM1AND2        },
+    { "vid_screenshotcompression 10",                DOOM1AND2        },
+    { "vid_screenshotcompression 6",                 DOOM1AND2        },
     { "vid_showfps ",                                DOOM1AND2        },
     { "vid_showfps off",                             DOOM1AND2        },
     { "vid_showfps on",                              DOOM1AND2        },
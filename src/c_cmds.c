@@ -69,6 +69,7 @@
 #include "v_video.h"
 #include "version.h"
 #include "w_wad.h"
+#include "z_zone.h"
 
 #define ALIASCMDFORMAT                  BOLDITALICS("alias") " [[" BOLD("\"") "]" BOLDITALICS("command") "[" BOLD(";") " " \
                                         BOLDITALICS("command") " ..." BOLD("\"") "]]"
@@ -302,6 +303,7 @@ static void maxzoom_action_func(void);
 static void menu_action_func(void);
 static void nextweapon_action_func(void);
 static void prevweapon_action_func(void);
+static void rewind_action_func(void);
 static void right_action_func(void);
 static void rotatemode_action_func(void);
 static void screenshot_action_func(void);
@@ -337,6 +339,7 @@ action_t actions[] =
     { "+menu",        true,  false, menu_action_func,        &keyboardmenu,        &keyboardmenu2,        &mousemenu,        &controllermenu,        NULL            },
     { "+nextweapon",  true,  false, nextweapon_action_func,  &keyboardnextweapon,  &keyboardnextweapon2,  &mousenextweapon,  &controllernextweapon,  NULL            },
     { "+prevweapon",  true,  false, prevweapon_action_func,  &keyboardprevweapon,  &keyboardprevweapon2,  &mouseprevweapon,  &controllerprevweapon,  NULL            },
+    { "+rewind",      true,  false, rewind_action_func,      &keyboardrewind,      &keyboardrewind2,      NULL,              NULL,                   NULL            },
     { "+right",       true,  false, right_action_func,       &keyboardright,       &keyboardright2,       &mouseright,       &controllerright,       NULL            },
     { "+rotatemode",  true,  true,  rotatemode_action_func,  &keyboardrotatemode,  &keyboardrotatemode2,  &mouserotatemode,  &controllerrotatemode,  NULL            },
     { "+run",         true,  false, NULL,                    &keyboardrun,         &keyboardrun2,         &mouserun,         &controllerrun,         NULL            },
@@ -365,6 +368,9 @@ static bool nightmare_func1(char *cmd, char *parms);
 static bool null_func1(char *cmd, char *parms);
 
 static void bindlist_func2(char *cmd, char *parms);
+static void cachestats_func2(char *cmd, char *parms);
+static bool capture_func1(char *cmd, char *parms);
+static void capture_func2(char *cmd, char *parms);
 static void clear_func2(char *cmd, char *parms);
 static void cmdlist_func2(char *cmd, char *parms);
 static bool condump_func1(char *cmd, char *parms);
@@ -387,6 +393,7 @@ static bool map_func1(char *cmd, char *parms);
 static void map_func2(char *cmd, char *parms);
 static void maplist_func2(char *cmd, char *parms);
 static void mapstats_func2(char *cmd, char *parms);
+static void memory_func2(char *cmd, char *parms);
 static bool name_func1(char *cmd, char *parms);
 static void name_func2(char *cmd, char *parms);
 static void newgame_func2(char *cmd, char *parms);
@@ -408,6 +415,7 @@ static void respawnmonsters_func2(char *cmd, char *parms);
 static void restartmap_func2(char *cmd, char *parms);
 static bool resurrect_func1(char *cmd, char *parms);
 static void resurrect_func2(char *cmd, char *parms);
+static void rewind_func2(char *cmd, char *parms);
 static void save_func2(char *cmd, char *parms);
 static bool spawn_func1(char *cmd, char *parms);
 static void spawn_func2(char *cmd, char *parms);
@@ -416,6 +424,7 @@ static void take_func2(char *cmd, char *parms);
 static bool teleport_func1(char *cmd, char *parms);
 static void teleport_func2(char *cmd, char *parms);
 static void thinglist_func2(char *cmd, char *parms);
+static void thingstats_func2(char *cmd, char *parms);
 static void timer_func2(char *cmd, char *parms);
 static void toggle_func2(char *cmd, char *parms);
 static void unbind_func2(char *cmd, char *parms);
@@ -658,6 +667,10 @@ consolecmd_t consolecmds[] =
         "Binds an " BOLDITALICS("+action") " or a string of " BOLDITALICS("commands") " to a " BOLDITALICS("control") "."),
     CCMD(bindlist, "", "", null_func1, bindlist_func2, false, "",
         "Lists all controls bound to an " BOLDITALICS("+action") " or a string of commands."),
+    CCMD(cachestats, "", "", null_func1, cachestats_func2, false, "",
+        "Shows stats about the lump cache."),
+    CCMD(capture, "", "", capture_func1, capture_func2, true, "[" BOLD("raw") "]",
+        "Starts or stops capturing every frame to the screenshots folder, either as PNG files or as a " BOLD("raw") " stream."),
     CVAR_BOOL(centerweapon, centreweapon, "", bool_cvars_func1, bool_cvars_func2, CF_NONE, BOOLVALUEALIAS,
         "Toggles centering your weapon when fired."),
     CCMD(clear, "", "", null_func1, clear_func2, false, "",
@@ -786,6 +799,10 @@ consolecmd_t consolecmds[] =
         "The amount of time you have been in the current map."),
     CVAR_BOOL(melt, "", "", bool_cvars_func1, bool_cvars_func2, CF_NONE, BOOLVALUEALIAS,
         "Toggles a melting effect when transitioning between some screens."),
+    CVAR_INT(mem_cachebudget, "", "", int_cvars_func1, int_cvars_func2, CF_NONE, NOVALUEALIAS,
+        "The amount of memory, in megabytes, kept for lumps no longer in use (" BOLD("0") " to " BOLD("1,024") ")."),
+    CCMD(memory, "", "", null_func1, memory_func2, true, "[" BOLDITALICS("filename") "[" BOLD(".csv") "]]",
+        "Shows how much memory is being used, and by what, or dumps it to a file."),
     CVAR_BOOL(menuhighlight, "", "", bool_cvars_func1, bool_cvars_func2, CF_NONE, BOOLVALUEALIAS,
         "Toggles the highlighting of items selected in the menu."),
     CVAR_BOOL(menushadow, "", "", bool_cvars_func1, bool_cvars_func2, CF_NONE, BOOLVALUEALIAS,
@@ -844,6 +861,8 @@ consolecmd_t consolecmds[] =
         "Toggles the translucency of blood splats."),
     CVAR_BOOL(r_brightmaps, "", "", bool_cvars_func1, r_brightmaps_func2, CF_NONE, BOOLVALUEALIAS,
         "Toggles brightmaps on some wall textures."),
+    CVAR_BOOL(r_columnmajor, "", "", bool_cvars_func1, bool_cvars_func2, CF_NONE, BOOLVALUEALIAS,
+        "Toggles drawing walls, floors, ceilings and skies one column at a time into a separate buffer."),
     CVAR_BOOL(r_corpses_color, r_corpses_colour, "", bool_cvars_func1, bool_cvars_func2, CF_NONE, BOOLVALUEALIAS,
         "Toggles randomly colored marine corpses."),
     CVAR_BOOL(r_corpses_gib, "", "", bool_cvars_func1, bool_cvars_func2, CF_NONE, BOOLVALUEALIAS,
@@ -955,6 +974,8 @@ consolecmd_t consolecmds[] =
         "Restarts the current map."),
     CCMD(resurrect, "", "", resurrect_func1, resurrect_func2, true, RESURRECTCMDFORMAT,
         "Resurrects the " BOLD("player") ", " BOLD("all") " monsters, or a type of " BOLDITALICS("monster") "."),
+    CCMD(rewind, "", "", game_ccmd_func1, rewind_func2, true, "[" BOLDITALICS("seconds") "]",
+        "Rewinds the current map by a number of " BOLDITALICS("seconds") ", up to a minute."),
     CVAR_INT(s_channels, "", "", int_cvars_func1, int_cvars_func2, CF_NONE, NOVALUEALIAS,
         "The number of sound effects that can be played at the same time (" BOLD("8") " to " BOLD("64") ")."),
     CVAR_BOOL(s_lowermenumusic, "", "", bool_cvars_func1, bool_cvars_func2, CF_NONE, BOOLVALUEALIAS,
@@ -992,6 +1013,8 @@ consolecmd_t consolecmds[] =
         "Teleports you to (" BOLDITALICS("x") ", " BOLDITALICS("y") ", " BOLDITALICS("z") ") in the current map."),
     CCMD(thinglist, "", "", game_ccmd_func1, thinglist_func2, false, "",
         "Lists all things in the current map."),
+    CCMD(thingstats, "", "", game_ccmd_func1, thingstats_func2, false, "",
+        "Shows how many things are in use, free and at their peak in the current map."),
     CCMD(timer, "", "", null_func1, timer_func2, true, TIMERCMDFORMAT,
         "Sets a timer to exit each map after a number of " BOLDITALICS("minutes") "."),
     CCMD(toggle, "", "", null_func1, toggle_func2, true, TOGGLECMDFORMAT,
@@ -1053,6 +1076,8 @@ consolecmd_t consolecmds[] =
         "The filter applied when scaling every frame (" BOLD("\"nearest\"") ", " BOLD("\"linear\"") " or " BOLD("\"nearest_linear\"") ")."),
     CVAR_OTHER(vid_screenresolution, "", "", null_func1, vid_screenresolution_func2,
         "The screen's resolution when fullscreen (" BOLD("desktop") " or " BOLD(ITALICS("width") "\xD7" ITALICS("height")) ")."),
+    CVAR_INT(vid_screenshotcompression, "", "", int_cvars_func1, int_cvars_func2, CF_NONE, NOVALUEALIAS,
+        "How much screenshots are compressed (" BOLD("0") " to " BOLD("10") ")."),
     CVAR_BOOL(vid_showfps, "", "", bool_cvars_func1, vid_showfps_func2, CF_STARTUPRESET, BOOLVALUEALIAS,
         "Toggles showing the number of frames per second."),
 #if defined(__APPLE__)
@@ -1218,6 +1243,12 @@ static void prevweapon_action_func(void)
         G_PrevWeapon();
 }
 
+static void rewind_action_func(void)
+{
+    if (gamestate == GS_LEVEL)
+        G_Rewind(1);
+}
+
 static void right_action_func(void)
 {
     if (gamestate == GS_LEVEL)
@@ -2165,6 +2196,62 @@ static void bindlist_func2(char *cmd, char *parms)
     }
 }
 
+//
+// cachestats CCMD
+//
+static void cachestats_func2(char *cmd, char *parms)
+{
+    const int   tabs[MAXTABS] = { 160 };
+    size_t      released;
+    const int   size = (int)(W_LumpCacheSize(&released) / 1024);
+    char        *temp1 = commify(lumpcachehits);
+    char        *temp2 = commify(lumpcachemisses);
+    char        *temp3 = commify(lumpcacheevictions);
+    char        *temp4 = commify(size);
+    char        *temp5 = commify((int64_t)(released / 1024));
+    char        *temp6 = commify((int64_t)mem_cachebudget * 1024);
+
+    C_TabbedOutput(tabs, "Hits\t%s", temp1);
+    C_TabbedOutput(tabs, "Misses\t%s", temp2);
+    C_TabbedOutput(tabs, "Evictions\t%s", temp3);
+    C_TabbedOutput(tabs, "Resident\t%s KB", temp4);
+    C_TabbedOutput(tabs, "Not in use\t%s KB", temp5);
+    C_TabbedOutput(tabs, "Budget\t%s KB", temp6);
+
+    free(temp1);
+    free(temp2);
+    free(temp3);
+    free(temp4);
+    free(temp5);
+    free(temp6);
+}
+
+//
+// capture CCMD
+//
+static bool capture_func1(char *cmd, char *parms)
+{
+    return (!*parms || M_StringCompare(parms, "raw"));
+}
+
+static void capture_func2(char *cmd, char *parms)
+{
+    if (capturing)
+    {
+        const int   frames = V_StopCapture();
+        char        *temp = commify(frames);
+
+        C_Output("%s frame%s %s captured to " BOLD("%s%s") ".", temp, (frames == 1 ? "" : "s"),
+            (frames == 1 ? "was" : "were"), V_CapturePath(), (capturingraw ? "" : " *.png"));
+        free(temp);
+    }
+    else if (V_StartCapture(*parms))
+        C_Output("Capturing every frame to " BOLD("%s%s") ". Enter " BOLD("capture") " again to stop.",
+            V_CapturePath(), (*parms ? "" : " *.png"));
+    else
+        C_Warning(0, BOLD("%s") " couldn't be created.", V_CapturePath());
+}
+
 //
 // clear CCMD
 //
@@ -5543,6 +5630,120 @@ static void mapstats_func2(char *cmd, char *parms)
     }
 }
 
+//
+// memory CCMD
+//
+#define MAXMEMORYSITES  20
+
+static const char *zonetagnames[PU_MAX] = { "", "Static", "Level", "Level specials", "Cache" };
+
+static int memory_cmp(const void *a, const void *b)
+{
+    const size_t    bytes1 = (*(const zonesite_t **)a)->bytes;
+    const size_t    bytes2 = (*(const zonesite_t **)b)->bytes;
+
+    return ((bytes1 < bytes2) - (bytes1 > bytes2));
+}
+
+static void memory_func2(char *cmd, char *parms)
+{
+    zonesite_t  **sites = malloc(MAX(numzonesites, 1) * sizeof(*sites));
+
+    for (int i = 0; i < numzonesites; i++)
+        sites[i] = &zonesites[i];
+
+    qsort(sites, numzonesites, sizeof(*sites), &memory_cmp);
+
+    if (*parms)
+    {
+        char        consolefolder[MAX_PATH];
+        char        filename[MAX_PATH];
+        const char  *appdatafolder = M_GetAppDataFolder();
+        FILE        *file;
+
+        M_snprintf(consolefolder, sizeof(consolefolder), "%s" DIR_SEPARATOR_S DOOMRETRO_CONSOLEFOLDER, appdatafolder);
+        M_MakeDirectory(consolefolder);
+        M_snprintf(filename, sizeof(filename), "%s" DIR_SEPARATOR_S "%s%s",
+            consolefolder, parms, (strchr(parms, '.') ? "" : ".csv"));
+
+        if ((file = fopen(filename, "wt")))
+        {
+            fputs("type,name,blocks,bytes,peak bytes,overhead bytes,allocations\n", file);
+
+            for (int i = PU_STATIC; i < PU_MAX; i++)
+                fprintf(file, "tag,%s,%i,%zu,%zu,%zu,\n", zonetagnames[i], zonetagstats[i].blocks,
+                    zonetagstats[i].bytes, zonetagstats[i].peakbytes, zonetagstats[i].overhead);
+
+            for (int i = 0; i < numzonesites; i++)
+                fprintf(file, "site,%s:%i,%i,%zu,,,%i\n", leafname((char *)sites[i]->file), sites[i]->line,
+                    sites[i]->blocks, sites[i]->bytes, sites[i]->allocations);
+
+            fclose(file);
+
+            C_Output("The memory stats were dumped into " BOLD("%s") ".", filename);
+        }
+        else
+            C_Warning(0, BOLD("%s") " couldn't be created.", filename);
+    }
+    else
+    {
+        const int   tabs[MAXTABS] = { 160, 240, 340 };
+        int         blocks = 0;
+        size_t      bytes = 0;
+        size_t      overhead = 0;
+
+        C_TabbedOutput(tabs, BOLD("Tag") "\t" BOLD("Blocks") "\t" BOLD("Size") "\t" BOLD("Peak"));
+
+        for (int i = PU_STATIC; i < PU_MAX; i++)
+        {
+            char    *temp1 = commify(zonetagstats[i].blocks);
+            char    *temp2 = commify(zonetagstats[i].bytes / 1024);
+            char    *temp3 = commify(zonetagstats[i].peakbytes / 1024);
+
+            C_TabbedOutput(tabs, "%s\t%s\t%s KB\t%s KB", zonetagnames[i], temp1, temp2, temp3);
+
+            blocks += zonetagstats[i].blocks;
+            bytes += zonetagstats[i].bytes;
+            overhead += zonetagstats[i].overhead;
+
+            free(temp1);
+            free(temp2);
+            free(temp3);
+        }
+
+        {
+            char    *temp1 = commify(blocks);
+            char    *temp2 = commify(bytes / 1024);
+            char    *temp3 = commify(overhead / 1024);
+
+            C_TabbedOutput(tabs, "Total\t%s\t%s KB", temp1, temp2);
+            C_TabbedOutput(tabs, "Overhead\t\t%s KB", temp3);
+
+            free(temp1);
+            free(temp2);
+            free(temp3);
+        }
+
+        C_TabbedOutput(tabs, BOLD("Allocated from") "\t" BOLD("Blocks") "\t" BOLD("Size") "\t" BOLD("Allocations"));
+
+        for (int i = 0; i < MIN(numzonesites, MAXMEMORYSITES) && sites[i]->bytes; i++)
+        {
+            char    *temp1 = commify(sites[i]->blocks);
+            char    *temp2 = commify(sites[i]->bytes / 1024);
+            char    *temp3 = commify(sites[i]->allocations);
+
+            C_TabbedOutput(tabs, "%s:%i\t%s\t%s KB\t%s",
+                leafname((char *)sites[i]->file), sites[i]->line, temp1, temp2, temp3);
+
+            free(temp1);
+            free(temp2);
+            free(temp3);
+        }
+    }
+
+    free(sites);
+}
+
 //
 // name CCMD
 //
@@ -7727,6 +7928,8 @@ static void C_VerifyResetAll(const int key)
         keyboardnextweapon2 = KEYNEXTWEAPON2_DEFAULT;
         keyboardprevweapon = KEYPREVWEAPON_DEFAULT;
         keyboardprevweapon2 = KEYPREVWEAPON2_DEFAULT;
+        keyboardrewind = KEYREWIND_DEFAULT;
+        keyboardrewind2 = KEYREWIND2_DEFAULT;
         keyboardright = KEYRIGHT_DEFAULT;
         keyboardright2 = KEYRIGHT2_DEFAULT;
         keyboardrotatemode = KEYROTATEMODE_DEFAULT;
@@ -8202,6 +8405,25 @@ static void resurrect_func2(char *cmd, char *parms)
     }
 }
 
+//
+// rewind CCMD
+//
+static void rewind_func2(char *cmd, char *parms)
+{
+    int seconds = 1;
+
+    if (*parms && sscanf(parms, "%10i", &seconds) != 1)
+    {
+        const int   i = C_GetIndex(cmd);
+
+        C_ShowFormat(i);
+        C_ShowDescription(i);
+        return;
+    }
+
+    G_Rewind(seconds);
+}
+
 //
 // save CCMD
 //
@@ -9003,6 +9225,25 @@ static void thinglist_func2(char *cmd, char *parms)
     }
 }
 
+//
+// thingstats CCMD
+//
+static void thingstats_func2(char *cmd, char *parms)
+{
+    const int   tabs[MAXTABS] = { 160 };
+    char        *temp1 = commify(livemobjs);
+    char        *temp2 = commify((int64_t)totalmobjs - livemobjs);
+    char        *temp3 = commify(peakmobjs);
+
+    C_TabbedOutput(tabs, "In use\t%s", temp1);
+    C_TabbedOutput(tabs, "Free\t%s", temp2);
+    C_TabbedOutput(tabs, "Peak\t%s", temp3);
+
+    free(temp1);
+    free(temp2);
+    free(temp3);
+}
+
 //
 // timer CCMD
 //
@@ -10448,6 +10689,7 @@ static void r_detail_func2(char *cmd, char *parms)
             M_SaveCVARs();
             STLib_Init();
             R_InitColumnFunctions();
+            setsizeneeded = true;
         }
     }
     else
@@ -10775,6 +11017,7 @@ static void r_lowpixelsize_func2(char *cmd, char *parms)
         r_lowpixelsize = M_StringDuplicate(parms);
         M_SaveCVARs();
         GetPixelSize();
+        setsizeneeded = true;
     }
     else
     {
@@ -2133,6 +2133,180 @@ bool C_ValidateInput(char *input)
     return false;
 }
 
+//
+// Autocomplete index
+// The entries in autocompletelist[] that apply to the current game are sorted
+// once, so that pressing TAB finds every entry starting with the input using a
+// binary search, rather than comparing the input against the entire list.
+//
+static int  *autocompleteindex;
+static int  numautocompleteindex;
+static bool autocompleteindexvalid;
+
+static int  *autocompletematches;
+static int  numautocompletematches;
+static int  *autocompletedistances;
+static bool fuzzyautocomplete;
+
+static bool C_IsAutocompleteGame(const int game)
+{
+    return (game == DOOM1AND2
+        || (gamemission == pack_plut && game == PLUTONIAONLY)
+        || (gamemission == pack_tnt && game == TNTONLY)
+        || (gamemission == pack_nerve && game == NERVEONLY)
+        || (masterlevels && game == MASTERLEVELSONLY)
+        || (legacyofrust && game == LEGACYOFRUSTONLY)
+        || (gamemission == doom && game == DOOM1ONLY)
+        || (gamemission != doom && game == DOOM2ONLY));
+}
+
+static int C_CompareAutocompleteText(const void *a, const void *b)
+{
+    const int   i = *(const int *)a;
+    const int   j = *(const int *)b;
+    const int   result = strcasecmp(autocompletelist[i].text, autocompletelist[j].text);
+
+    return (result ? result : i - j);
+}
+
+static int C_CompareAutocompleteOrder(const void *a, const void *b)
+{
+    return (*(const int *)a - *(const int *)b);
+}
+
+static int C_CompareAutocompleteDistance(const void *a, const void *b)
+{
+    const int   i = *(const int *)a;
+    const int   j = *(const int *)b;
+
+    return (autocompletedistances[i] != autocompletedistances[j] ?
+        autocompletedistances[i] - autocompletedistances[j] : i - j);
+}
+
+void C_InvalidateAutocompleteIndex(void)
+{
+    autocompleteindexvalid = false;
+}
+
+static void C_BuildAutocompleteIndex(void)
+{
+    int numentries = 0;
+
+    while (*autocompletelist[numentries].text)
+        numentries++;
+
+    autocompleteindex = I_Realloc(autocompleteindex, numentries * sizeof(*autocompleteindex));
+    autocompletematches = I_Realloc(autocompletematches, numentries * sizeof(*autocompletematches));
+    autocompletedistances = I_Realloc(autocompletedistances, numentries * sizeof(*autocompletedistances));
+    numautocompleteindex = 0;
+
+    for (int i = 0; i < numentries; i++)
+        if (C_IsAutocompleteGame(autocompletelist[i].game))
+            autocompleteindex[numautocompleteindex++] = i;
+
+    qsort(autocompleteindex, numautocompleteindex, sizeof(*autocompleteindex), C_CompareAutocompleteText);
+    autocompleteindexvalid = true;
+}
+
+static void C_FindAutocompleteMatches(const char *input)
+{
+    const int   len1 = (int)strlen(input);
+    const int   spaces1 = numspaces(input);
+    const bool  endspace1 = (input[len1 - 1] == ' ');
+    int         first = 0;
+    int         last;
+
+    if (!autocompleteindexvalid)
+        C_BuildAutocompleteIndex();
+
+    numautocompletematches = 0;
+    fuzzyautocomplete = false;
+
+    if (input[len1 - 1] == '+')
+        return;
+
+    // find the first entry that starts with the input
+    last = numautocompleteindex;
+
+    while (first < last)
+    {
+        const int   middle = (first + last) / 2;
+
+        if (strncasecmp(autocompletelist[autocompleteindex[middle]].text, input, len1) < 0)
+            first = middle + 1;
+        else
+            last = middle;
+    }
+
+    for (int i = first; i < numautocompleteindex; i++)
+    {
+        const char  *output = autocompletelist[autocompleteindex[i]].text;
+        const int   len2 = (int)strlen(output);
+        int         spaces2;
+        bool        endspace2;
+
+        if (strncasecmp(output, input, len1))
+            break;
+
+        spaces2 = numspaces(output);
+        endspace2 = (len2 > 0 && output[len2 - 1] == ' ');
+
+        if (!M_StringCompare(output, input)
+            && ((!spaces1 && (!spaces2 || (spaces2 == 1 && endspace2)))
+                || (spaces1 == 1 && !endspace1 && (spaces2 == 1 || (spaces2 == 2 && endspace2)))
+                || (spaces1 == 2 && !endspace1 && (spaces2 == 2 || (spaces2 == 3 && endspace2)))
+                || (spaces1 == 3 && !endspace1)))
+            autocompletematches[numautocompletematches++] = autocompleteindex[i];
+    }
+
+    if (numautocompletematches)
+    {
+        // cycle through the matches in the same order they appear in the list
+        qsort(autocompletematches, numautocompletematches, sizeof(*autocompletematches),
+            C_CompareAutocompleteOrder);
+        return;
+    }
+
+    // nothing starts with the input, so if it looks like a mistyped command or
+    // variable, offer the entries that are the fewest edits away from it instead
+    if (!spaces1 && len1 >= 3)
+    {
+        char    *temp1 = lowercase(M_StringDuplicate(input));
+
+        for (int i = 0; i < numautocompleteindex; i++)
+        {
+            const int   index = autocompleteindex[i];
+            char        output[255];
+            int         len2;
+            int         distance;
+
+            M_StringCopy(output, autocompletelist[index].text, sizeof(output));
+            len2 = (int)strlen(output);
+
+            if (len2 > 0 && output[len2 - 1] == ' ')
+                output[--len2] = '\0';
+
+            if (!len2 || numspaces(output) || abs(len2 - len1) > 2)
+                continue;
+
+            if ((distance = M_LevenshteinDistance(temp1, lowercase(output))) <= 2)
+            {
+                autocompletedistances[index] = distance;
+                autocompletematches[numautocompletematches++] = index;
+            }
+        }
+
+        free(temp1);
+
+        if (numautocompletematches)
+        {
+            qsort(autocompletematches, numautocompletematches, sizeof(*autocompletematches),
+                C_CompareAutocompleteDistance);
+            fuzzyautocomplete = true;
+        }
+    }
+}
+
 bool C_Responder(event_t *ev)
 {
     static int  autocomplete = -1;
@@ -2367,11 +2541,8 @@ bool C_Responder(event_t *ev)
                 if (consoleinput[0] != '\0' && caretpos == len)
                 {
                     const int   scrolldirection = ((modstate & KMOD_SHIFT) ? -1 : 1);
-                    const int   start = autocomplete;
                     static char input[255];
                     char        prefix[255] = "";
-                    int         spaces1;
-                    bool        endspace1;
 
                     for (i = len - 1; i >= 0; i--)
                         if ((consoleinput[i] == ';'
@@ -2408,60 +2579,35 @@ bool C_Responder(event_t *ev)
                         }
                     }
 
-                    spaces1 = numspaces(input);
-                    endspace1 = (input[strlen(input) - 1] == ' ');
+                    if (autocomplete == -1)
+                        C_FindAutocompleteMatches(input);
 
-                    while ((scrolldirection == -1 && autocomplete > 0)
-                        || (scrolldirection == 1 && (autocomplete == -1 || *autocompletelist[autocomplete].text)))
+                    if ((scrolldirection == -1 && autocomplete > 0)
+                        || (scrolldirection == 1 && autocomplete < numautocompletematches - 1))
                     {
                         static char output[255];
+                        char        *temp;
 
                         autocomplete += scrolldirection;
-                        M_StringCopy(output, autocompletelist[autocomplete].text, sizeof(output));
+                        M_StringCopy(output, autocompletelist[autocompletematches[autocomplete]].text, sizeof(output));
+
+                        if (fuzzyautocomplete)
+                            temp = M_StringJoin(prefix, (isuppercase(input) ? uppercase(output) : output), NULL);
+                        else if (isuppercase(input))
+                            temp = M_StringJoin(prefix, M_StringReplaceFirst(uppercase(output), input, input), NULL);
+                        else if (islowercase(input))
+                            temp = M_StringJoin(prefix, M_StringReplaceFirst(lowercase(output), input, input), NULL);
+                        else
+                            temp = M_StringJoin(prefix, M_StringReplaceFirst(output, input, input), NULL);
 
-                        if (!M_StringCompare(output, input))
-                        {
-                            const int   game = autocompletelist[autocomplete].game;
-                            const int   len2 = (int)strlen(output);
-                            const int   spaces2 = numspaces(output);
-                            const bool  endspace2 = (len2 > 0 && output[len2 - 1] == ' ');
-
-                            if ((game == DOOM1AND2
-                                || (gamemission == pack_plut && game == PLUTONIAONLY)
-                                || (gamemission == pack_tnt && game == TNTONLY)
-                                || (gamemission == pack_nerve && game == NERVEONLY)
-                                || (masterlevels && game == MASTERLEVELSONLY)
-                                || (legacyofrust && game == LEGACYOFRUSTONLY)
-                                || (gamemission == doom && game == DOOM1ONLY)
-                                || (gamemission != doom && game == DOOM2ONLY))
-                                && M_StringStartsWith(output, input)
-                                && input[strlen(input) - 1] != '+'
-                                && ((!spaces1 && (!spaces2 || (spaces2 == 1 && endspace2)))
-                                    || (spaces1 == 1 && !endspace1 && (spaces2 == 1 || (spaces2 == 2 && endspace2)))
-                                    || (spaces1 == 2 && !endspace1 && (spaces2 == 2 || (spaces2 == 3 && endspace2)))
-                                    || (spaces1 == 3 && !endspace1)))
-                            {
-                                char    *temp;
-
-                                if (isuppercase(input))
-                                    temp = M_StringJoin(prefix, M_StringReplaceFirst(uppercase(output), input, input), NULL);
-                                else if (islowercase(input))
-                                    temp = M_StringJoin(prefix, M_StringReplaceFirst(lowercase(output), input, input), NULL);
-                                else
-                                    temp = M_StringJoin(prefix, M_StringReplaceFirst(output, input, input), NULL);
-
-                                C_AddToUndoHistory();
-                                M_StringCopy(consoleinput, temp, sizeof(consoleinput));
-                                caretpos = selectstart = selectend = len2 + (int)strlen(prefix);
-                                caretwait = I_GetTimeMS() + CARETBLINKTIME;
-                                showcaret = true;
-                                free(temp);
-                                return true;
-                            }
-                        }
+                        C_AddToUndoHistory();
+                        M_StringCopy(consoleinput, temp, sizeof(consoleinput));
+                        caretpos = selectstart = selectend = (int)strlen(consoleinput);
+                        caretwait = I_GetTimeMS() + CARETBLINKTIME;
+                        showcaret = true;
+                        free(temp);
+                        return true;
                     }
-
-                    autocomplete = start;
                 }
 
                 break;
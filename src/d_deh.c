@@ -42,6 +42,7 @@
 #include "dstrings.h"
 #include "g_game.h"
 #include "i_system.h"
+#include "i_timer.h"
 #include "info.h"
 #include "m_cheat.h"
 #include "m_config.h"
@@ -2284,6 +2285,94 @@ static const deh_bexptr deh_bexptrs[] =
     { NULL,                   "A_NULL"                                                         }
 };
 
+// Hash tables of the keys, mnemonics and code pointer names above, so that each
+// one can be found without comparing it against every entry in its array in turn.
+#define DEH_HASHSIZE    256
+
+typedef struct
+{
+    int         first[DEH_HASHSIZE];
+    int         *next;
+    const char  **names;
+} deh_hash_t;
+
+static deh_hash_t   deh_mobjinfohash;
+static deh_hash_t   deh_mobjflagshash;
+static deh_hash_t   deh_mobjflags2hash;
+static deh_hash_t   deh_mobjflagsmbf21hash;
+static deh_hash_t   deh_weaponflagsmbf21hash;
+static deh_hash_t   deh_statehash;
+static deh_hash_t   deh_bexptrshash;
+static deh_hash_t   deh_strlookuphash;
+
+static unsigned int deh_HashKey(const char *key)
+{
+    unsigned int    hash = 0;
+
+    while (*key)
+        hash = hash * 31 + toupper(*key++);
+
+    return (hash & (DEH_HASHSIZE - 1));
+}
+
+//
+// deh_BuildHash
+// Hash the string found at offset in each of the count entries of size bytes in table.
+//
+static void deh_BuildHash(deh_hash_t *hash, const void *table, const size_t size,
+    const size_t offset, const int count)
+{
+    hash->next = I_Malloc(count * sizeof(*hash->next));
+    hash->names = I_Malloc(count * sizeof(*hash->names));
+
+    for (int i = 0; i < DEH_HASHSIZE; i++)
+        hash->first[i] = -1;
+
+    // add them in reverse, so the first of any duplicates is the one found
+    for (int i = count - 1; i >= 0; i--)
+    {
+        const char  *name = *(const char *const *)((const byte *)table + i * size + offset);
+
+        if ((hash->names[i] = name))
+        {
+            const unsigned int  key = deh_HashKey(name);
+
+            hash->next[i] = hash->first[key];
+            hash->first[key] = i;
+        }
+    }
+}
+
+static int deh_FindKey(const deh_hash_t *hash, const char *key)
+{
+    for (int i = hash->first[deh_HashKey(key)]; i >= 0; i = hash->next[i])
+        if (M_StringCompare(hash->names[i], key))
+            return i;
+
+    return -1;
+}
+
+static void deh_InitHashes(void)
+{
+    if (deh_mobjinfohash.next)
+        return;
+
+    deh_BuildHash(&deh_mobjinfohash, deh_mobjinfo, sizeof(*deh_mobjinfo), 0, DEH_MOBJINFOMAX);
+    deh_BuildHash(&deh_mobjflagshash, deh_mobjflags, sizeof(*deh_mobjflags),
+        offsetof(struct deh_flag_s, name), DEH_MOBJFLAGMAX);
+    deh_BuildHash(&deh_mobjflags2hash, deh_mobjflags2, sizeof(*deh_mobjflags2),
+        offsetof(struct deh_flag_s, name), DEH_MOBJFLAG2MAX);
+    deh_BuildHash(&deh_mobjflagsmbf21hash, deh_mobjflags_mbf21, sizeof(*deh_mobjflags_mbf21),
+        offsetof(struct deh_flag_s, name), DEH_MOBJFLAGMAX_MBF21);
+    deh_BuildHash(&deh_weaponflagsmbf21hash, deh_weaponflags_mbf21, sizeof(*deh_weaponflags_mbf21),
+        offsetof(struct deh_flag_s, name), DEH_WEAPONFLAGMAX_MBF21);
+    deh_BuildHash(&deh_statehash, deh_state, sizeof(*deh_state), 0, arrlen(deh_state));
+    deh_BuildHash(&deh_bexptrshash, deh_bexptrs, sizeof(*deh_bexptrs),
+        offsetof(deh_bexptr, lookup), arrlen(deh_bexptrs));
+    deh_BuildHash(&deh_strlookuphash, deh_strlookup, sizeof(*deh_strlookup),
+        offsetof(deh_strs, lookup), deh_numstrlookup);
+}
+
 // to hold startup code pointers from INFO.C
 extern actionf_t    *deh_codeptr;
 
@@ -2352,10 +2441,14 @@ void D_ProcessDehFile(char *filename, int lumpnum, bool autoloaded)
     char                inbuffer[DEH_BUFFERMAX];        // Place to put the primary infostring
     static unsigned int last_i = DEH_BLOCKMAX - 1;
     static int          filepos;
+    const uint64_t      starttime = I_GetTimeUS();
+    char                parsetime[64];
 
     linecount = 0;
     addtodehmaptitlecount = false;
 
+    deh_InitHashes();
+
     // killough 10/98: allow DEH files to come from WAD lumps
     if (filename)
     {
@@ -2468,6 +2561,7 @@ void D_ProcessDehFile(char *filename, int lumpnum, bool autoloaded)
     else if (infile.file)
         fclose(infile.file);
 
+    M_snprintf(parsetime, sizeof(parsetime), " in %.2f milliseconds", (I_GetTimeUS() - starttime) / 1000.0);
     dehcount++;
 
     if (addtodehmaptitlecount)
@@ -2479,9 +2573,9 @@ void D_ProcessDehFile(char *filename, int lumpnum, bool autoloaded)
         char    *temp2 = uppercase(lumpinfo[lumpnum]->name);
 
         if (!infile.resourcewad && !devparm)
-            C_Output("%s line%s %s been parsed in the " BOLD("%s") " lump in the %s " BOLD("%s") ".",
+            C_Output("%s line%s %s been parsed in the " BOLD("%s") " lump in the %s " BOLD("%s") "%s.",
                 temp1, (linecount == 1 ? "" : "s"), (linecount == 1 ? "has" : "have"), temp2,
-                (W_WadType(filename) == IWAD ? "IWAD" : "PWAD"), filename);
+                (W_WadType(filename) == IWAD ? "IWAD" : "PWAD"), filename, parsetime);
 
         free(temp1);
         free(temp2);
@@ -2490,11 +2584,11 @@ void D_ProcessDehFile(char *filename, int lumpnum, bool autoloaded)
     {
         char    *temp = commify(linecount);
 
-        C_Output("%s line%s %s been %s in the " ITALICS("DeHackEd") "%s file " BOLD("%s") ".",
+        C_Output("%s line%s %s been %s in the " ITALICS("DeHackEd") "%s file " BOLD("%s") "%s.",
             temp, (linecount == 1 ? "" : "s"), (linecount == 1 ? "has" : "have"),
             (autoloaded ? "automatically parsed" : "parsed"),
             (M_StringEndsWith(filename, "BEX") ? " with " ITALICS("BOOM") " extensions" : ""),
-            GetCorrectCase(filename));
+            GetCorrectCase(filename), parsetime);
 
         free(temp);
     }
@@ -2522,7 +2616,7 @@ static void deh_procBexCodePointers(DEHFILE *fpin, const char *line)
     // for this one, we just read 'em until we hit a blank line
     while (!dehfeof(fpin) && *inbuffer && *inbuffer != ' ')
     {
-        int     i = -1;                         // looper
+        int     i;
         bool    found = false;                  // know if we found this one during lookup or not
 
         if (!dehfgets(inbuffer, sizeof(inbuffer), fpin))
@@ -2555,25 +2649,20 @@ static void deh_procBexCodePointers(DEHFILE *fpin, const char *line)
         strcpy(key, "A_");                      // reusing the key area to prefix the mnemonic
         strcat(key, ptr_lstrip(mnemonic));
 
-        do
+        if ((i = deh_FindKey(&deh_bexptrshash, key)) >= 0)
         {
-            i++;
+            states[indexnum].action = deh_bexptrs[i].cptr;
 
-            if (M_StringCompare(key, deh_bexptrs[i].lookup))
-            {
-                states[indexnum].action = deh_bexptrs[i].cptr;
-
-                if (devparm)
-                    C_Output(" - applied %s from codeptr[%i] to states[%i]", deh_bexptrs[i].lookup, i, indexnum);
+            if (devparm)
+                C_Output(" - applied %s from codeptr[%i] to states[%i]", deh_bexptrs[i].lookup, i, indexnum);
 
-                if (deh_bexptrs[i].mbf == MBF)
-                    mbfcompatible = true;
-                else if (deh_bexptrs[i].mbf == MBF21)
-                    mbf21compatible = true;
+            if (deh_bexptrs[i].mbf == MBF)
+                mbfcompatible = true;
+            else if (deh_bexptrs[i].mbf == MBF21)
+                mbf21compatible = true;
 
-                found = true;
-            }
-        } while (!found && deh_bexptrs[i].cptr);
+            found = true;
+        }
 
         if (!found && !M_StringCompare(mnemonic, "NULL"))
             C_Warning(1, "Invalid frame pointer mnemonic \"%s\" at %i.", mnemonic, indexnum);
@@ -2698,11 +2787,8 @@ static void deh_procThing(DEHFILE *fpin, const char *line)
             continue;
         }
 
-        for (ix = 0; ix < DEH_MOBJINFOMAX; ix++)
+        if ((ix = deh_FindKey(&deh_mobjinfohash, key)) >= 0)
         {
-            if (!M_StringCompare(key, deh_mobjinfo[ix]))
-                continue;
-
             if (M_StringCompare(key, "Bits"))
             {
                 // bit set
@@ -2717,27 +2803,23 @@ static void deh_procThing(DEHFILE *fpin, const char *line)
                     // Use OR logic instead of addition, to allow repetition
                     for (value = 0; (strval = strtok(strval, ",+| \t\f\r")); strval = NULL)
                     {
-                        int iy;
+                        const int   iy = deh_FindKey(&deh_mobjflagshash, strval);
 
-                        for (iy = 0; iy < DEH_MOBJFLAGMAX; iy++)
+                        if (iy < 0)
                         {
-                            if (!M_StringCompare(strval, deh_mobjflags[iy].name))
-                                continue;
-
-                            if (devparm)
-                                C_Output("ORed value 0x%08x %s.", deh_mobjflags[iy].value, strval);
+                            C_Warning(1, "Could not find bit mnemonic \"%s\".", strval);
+                            continue;
+                        }
 
-                            if (M_StringCompare(key, "TRANSLUCENT"))
-                                boomcompatible = true;
-                            else if (M_StringCompare(key, "TOUCHY") || M_StringCompare(key, "BOUNCES") || M_StringCompare(key, "FRIEND"))
-                                mbfcompatible = true;
+                        if (devparm)
+                            C_Output("ORed value 0x%08x %s.", deh_mobjflags[iy].value, strval);
 
-                            value |= deh_mobjflags[iy].value;
-                            break;
-                        }
+                        if (M_StringCompare(key, "TRANSLUCENT"))
+                            boomcompatible = true;
+                        else if (M_StringCompare(key, "TOUCHY") || M_StringCompare(key, "BOUNCES") || M_StringCompare(key, "FRIEND"))
+                            mbfcompatible = true;
 
-                        if (iy >= DEH_MOBJFLAGMAX)
-                            C_Warning(1, "Could not find bit mnemonic \"%s\".", strval);
+                        value |= deh_mobjflags[iy].value;
                     }
 
                     // Don't worry about conversion -- simply print values
@@ -2756,22 +2838,18 @@ static void deh_procThing(DEHFILE *fpin, const char *line)
                 {
                     for (value = 0; (strval = strtok(strval, ",+| \t\f\r")); strval = NULL)
                     {
-                        int iy;
+                        const int   iy = deh_FindKey(&deh_mobjflags2hash, strval);
 
-                        for (iy = 0; iy < DEH_MOBJFLAG2MAX; iy++)
+                        if (iy < 0)
                         {
-                            if (!M_StringCompare(strval, deh_mobjflags2[iy].name))
-                                continue;
-
-                            if (devparm)
-                                C_Output("ORed value 0x%08x %s.", deh_mobjflags2[iy].value, strval);
-
-                            value |= deh_mobjflags2[iy].value;
-                            break;
+                            C_Warning(1, "Could not find bit mnemonic \"%s\".", strval);
+                            continue;
                         }
 
-                        if (iy >= DEH_MOBJFLAG2MAX)
-                            C_Warning(1, "Could not find bit mnemonic \"%s\".", strval);
+                        if (devparm)
+                            C_Output("ORed value 0x%08x %s.", deh_mobjflags2[iy].value, strval);
+
+                        value |= deh_mobjflags2[iy].value;
                     }
 
                     // Don't worry about conversion -- simply print values
@@ -2790,22 +2868,18 @@ static void deh_procThing(DEHFILE *fpin, const char *line)
                 {
                     for (value = 0; (strval = strtok(strval, ",+| \t\f\r")); strval = NULL)
                     {
-                        int iy;
+                        const int   iy = deh_FindKey(&deh_mobjflagsmbf21hash, strval);
 
-                        for (iy = 0; iy < DEH_MOBJFLAGMAX_MBF21; iy++)
+                        if (iy < 0)
                         {
-                            if (!M_StringCompare(strval, deh_mobjflags_mbf21[iy].name))
-                                continue;
-
-                            if (devparm)
-                                C_Output("ORed value 0x%08x %s.", deh_mobjflags_mbf21[iy].value, strval);
-
-                            value |= deh_mobjflags_mbf21[iy].value;
-                            break;
+                            C_Warning(1, "Could not find MBF21 bit mnemonic \"%s\".", strval);
+                            continue;
                         }
 
-                        if (iy >= DEH_MOBJFLAGMAX_MBF21)
-                            C_Warning(1, "Could not find MBF21 bit mnemonic \"%s\".", strval);
+                        if (devparm)
+                            C_Output("ORed value 0x%08x %s.", deh_mobjflags_mbf21[iy].value, strval);
+
+                        value |= deh_mobjflags_mbf21[iy].value;
                     }
 
                     // Don't worry about conversion -- simply print values
@@ -2857,7 +2931,6 @@ static void deh_procThing(DEHFILE *fpin, const char *line)
                 C_Output("Assigned %i to %s (%i) at index %i.", value, key, indexnum, ix);
 
             mobjinfo[indexnum].dehacked = true;
-            break;
         }
     }
 
@@ -2905,6 +2978,7 @@ static void deh_procFrame(DEHFILE *fpin, const char *line)
     char    inbuffer[DEH_BUFFERMAX];
     int     value;
     int     indexnum;
+    int     ix;
     char    *strval;
 
     M_StringCopy(inbuffer, line, DEH_BUFFERMAX - 1);
@@ -2942,136 +3016,108 @@ static void deh_procFrame(DEHFILE *fpin, const char *line)
             continue;
         }
 
-        if (M_StringCompare(key, deh_state[0]))                 // Sprite number
+        switch ((ix = deh_FindKey(&deh_statehash, key)))
         {
-            if (devparm)
-                C_Output(" - sprite = %i", value);
+            case 0:                                             // Sprite number
+                if (devparm)
+                    C_Output(" - sprite = %i", value);
 
-            states[indexnum].sprite = (spritenum_t)value;
-            states[indexnum].dehacked = dehacked = !BTSX;
-        }
-        else if (M_StringCompare(key, deh_state[1]))            // Sprite subnumber
-        {
-            if (devparm)
-                C_Output(" - frame = %i", value);
+                states[indexnum].sprite = (spritenum_t)value;
+                states[indexnum].dehacked = dehacked = !BTSX;
+                break;
 
-            states[indexnum].frame = value;
-            states[indexnum].dehacked = dehacked = !BTSX;
-        }
-        else if (M_StringCompare(key, deh_state[2]))            // Duration
-        {
-            if (devparm)
-                C_Output(" - tics = %i", value);
+            case 1:                                             // Sprite subnumber
+                if (devparm)
+                    C_Output(" - frame = %i", value);
 
-            states[indexnum].tics = value;
-            states[indexnum].dehacked = dehacked = !BTSX;
-        }
-        else if (M_StringCompare(key, deh_state[3]))            // Next frame
-        {
-            if (devparm)
-                C_Output(" - nextstate = %i", value);
+                states[indexnum].frame = value;
+                states[indexnum].dehacked = dehacked = !BTSX;
+                break;
 
-            states[indexnum].nextstate = value;
-            states[indexnum].dehacked = dehacked = !BTSX;
-        }
-        else if (M_StringCompare(key, deh_state[4]))            // Codep frame (not set in Frame deh block)
-            C_Warning(1, "Codep frame should not be set in Frame section.");
-        else if (M_StringCompare(key, deh_state[5]))            // Unknown 1
-        {
-            if (devparm)
-                C_Output(" - misc1 = %i", value);
+            case 2:                                             // Duration
+                if (devparm)
+                    C_Output(" - tics = %i", value);
 
-            states[indexnum].misc1 = value;
-            states[indexnum].dehacked = dehacked = !BTSX;
-        }
-        else if (M_StringCompare(key, deh_state[6]))            // Unknown 2
-        {
-            if (devparm)
-                C_Output(" - misc2 = %i", value);
+                states[indexnum].tics = value;
+                states[indexnum].dehacked = dehacked = !BTSX;
+                break;
 
-            states[indexnum].misc2 = value;
-            states[indexnum].dehacked = dehacked = !BTSX;
-        }
-        else if (!strcasecmp(key, deh_state[7]))                // Args1
-        {
-            states[indexnum].args[0] = value;
-            defined_codeptr_args[indexnum] |= (1 << 0);
-            mbf21compatible = true;
-        }
-        else if (!strcasecmp(key, deh_state[8]))                // Args2
-        {
-            states[indexnum].args[1] = value;
-            defined_codeptr_args[indexnum] |= (1 << 1);
-            mbf21compatible = true;
-        }
-        else if (!strcasecmp(key, deh_state[9]))                // Args3
-        {
-            states[indexnum].args[2] = value;
-            defined_codeptr_args[indexnum] |= (1 << 2);
-            mbf21compatible = true;
-        }
-        else if (!strcasecmp(key, deh_state[10]))               // Args4
-        {
-            states[indexnum].args[3] = value;
-            defined_codeptr_args[indexnum] |= (1 << 3);
-            mbf21compatible = true;
-        }
-        else if (!strcasecmp(key, deh_state[11]))               // Args5
-        {
-            states[indexnum].args[4] = value;
-            defined_codeptr_args[indexnum] |= (1 << 4);
-            mbf21compatible = true;
-        }
-        else if (!strcasecmp(key, deh_state[12]))               // Args6
-        {
-            states[indexnum].args[5] = value;
-            defined_codeptr_args[indexnum] |= (1 << 5);
-            mbf21compatible = true;
-        }
-        else if (!strcasecmp(key, deh_state[13]))               // Args7
-        {
-            states[indexnum].args[6] = value;
-            defined_codeptr_args[indexnum] |= (1 << 6);
-            mbf21compatible = true;
-        }
-        else if (!strcasecmp(key, deh_state[14]))               // Args8
-        {
-            states[indexnum].args[7] = value;
-            defined_codeptr_args[indexnum] |= (1 << 7);
-            mbf21compatible = true;
-        }
+            case 3:                                             // Next frame
+                if (devparm)
+                    C_Output(" - nextstate = %i", value);
 
-        // MBF21: process state flags
-        else if (!strcasecmp(key, deh_state[15]))               // MBF21 bits
-        {
-            if (!value)
-                for (value = 0; (strval = strtok(strval, ",+| \t\f\r")); strval = NULL)
-                {
-                    const struct deh_flag_s *flag;
+                states[indexnum].nextstate = value;
+                states[indexnum].dehacked = dehacked = !BTSX;
+                break;
+
+            case 4:                                             // Codep frame (not set in Frame deh block)
+                C_Warning(1, "Codep frame should not be set in Frame section.");
+                break;
+
+            case 5:                                             // Unknown 1
+                if (devparm)
+                    C_Output(" - misc1 = %i", value);
+
+                states[indexnum].misc1 = value;
+                states[indexnum].dehacked = dehacked = !BTSX;
+                break;
+
+            case 6:                                             // Unknown 2
+                if (devparm)
+                    C_Output(" - misc2 = %i", value);
+
+                states[indexnum].misc2 = value;
+                states[indexnum].dehacked = dehacked = !BTSX;
+                break;
+
+            case 7:                                             // Args1
+            case 8:                                             // Args2
+            case 9:                                             // Args3
+            case 10:                                            // Args4
+            case 11:                                            // Args5
+            case 12:                                            // Args6
+            case 13:                                            // Args7
+            case 14:                                            // Args8
+                states[indexnum].args[ix - 7] = value;
+                defined_codeptr_args[indexnum] |= (1 << (ix - 7));
+                mbf21compatible = true;
+                break;
 
-                    for (flag = deh_stateflags_mbf21; flag->name; flag++)
+            // MBF21: process state flags
+            case 15:                                            // MBF21 bits
+                if (!value)
+                    for (value = 0; (strval = strtok(strval, ",+| \t\f\r")); strval = NULL)
                     {
-                        if (strcasecmp(strval, flag->name))
-                            continue;
+                        const struct deh_flag_s *flag;
 
-                        value |= flag->value;
-                        break;
+                        for (flag = deh_stateflags_mbf21; flag->name; flag++)
+                        {
+                            if (strcasecmp(strval, flag->name))
+                                continue;
+
+                            value |= flag->value;
+                            break;
+                        }
                     }
-                }
 
-            states[indexnum].flags = value;
-            mbf21compatible = true;
-        }
-        else if (M_StringCompare(key, "translucent"))           // Translucent
-        {
-            if (devparm)
-                C_Output(" - translucent = %i", value);
+                states[indexnum].flags = value;
+                mbf21compatible = true;
+                break;
 
-            states[indexnum].translucent = !!value;             // bool
-            states[indexnum].dehacked = dehacked = !BTSX;
+            default:
+                if (M_StringCompare(key, "translucent"))        // Translucent
+                {
+                    if (devparm)
+                        C_Output(" - translucent = %i", value);
+
+                    states[indexnum].translucent = !!value;     // bool
+                    states[indexnum].dehacked = dehacked = !BTSX;
+                }
+                else
+                    C_Warning(1, "Invalid frame string index for \"%s\".", key);
+
+                break;
         }
-        else
-            C_Warning(1, "Invalid frame string index for \"%s\".", key);
     }
 }
 
@@ -3140,14 +3186,13 @@ static void deh_procPointer(DEHFILE *fpin, const char *line)
                 C_Output(" - applied %p from codeptr[%i] to states[%i]", (void *)deh_codeptr[value], value, indexnum);
 
             // Write BEX-oriented line to match:
-            for (int i = 0; i < arrlen(deh_bexptrs); i++)
-                if (!memcmp(&deh_bexptrs[i].cptr, &deh_codeptr[value], sizeof(actionf_t)))
-                {
-                    if (devparm)
+            if (devparm)
+                for (int i = 0; i < arrlen(deh_bexptrs); i++)
+                    if (!memcmp(&deh_bexptrs[i].cptr, &deh_codeptr[value], sizeof(actionf_t)))
+                    {
                         C_Output("BEX [CODEPTR] -> FRAME %i = %s", indexnum, &deh_bexptrs[i].lookup[2]);
-
-                    break;
-                }
+                        break;
+                    }
         }
         else
             C_Warning(1, "Invalid frame pointer index for \"%s\" at %i, xref %p.", key, value, (void *)deh_codeptr[value]);
@@ -3372,19 +3417,15 @@ static void deh_procWeapon(DEHFILE *fpin, const char *line)
             {
                 for (value = 0; (strval = strtok(strval, ",+| \t\f\r")); strval = NULL)
                 {
-                    int iy;
+                    const int   iy = deh_FindKey(&deh_weaponflagsmbf21hash, strval);
 
-                    for (iy = 0; iy < DEH_WEAPONFLAGMAX_MBF21; iy++)
+                    if (iy < 0)
                     {
-                        if (!M_StringCompare(strval, deh_weaponflags_mbf21[iy].name))
-                            continue;
-
-                        value |= deh_weaponflags_mbf21[iy].value;
-                        break;
+                        C_Warning(1, "Could not find MBF21 weapon bit mnemonic \"%s\".", strval);
+                        continue;
                     }
 
-                    if (iy >= DEH_WEAPONFLAGMAX_MBF21)
-                        C_Warning(1, "Could not find MBF21 weapon bit mnemonic \"%s\".", strval);
+                    value |= deh_weaponflags_mbf21[iy].value;
                 }
 
                 weaponinfo[indexnum].flags = value;
@@ -4106,7 +4147,8 @@ static bool deh_procStringSub(char *key, char *lookfor, char *newstring)
 {
     bool    found = false;  // loop exit flag
 
-    for (int i = 0; i < deh_numstrlookup; i++)
+    // looking up a key goes straight to it, but looking up a string still has to check every one
+    for (int i = (lookfor ? 0 : deh_FindKey(&deh_strlookuphash, key)); i >= 0 && i < deh_numstrlookup; i++)
         if ((found = (lookfor ? M_StringCompare(*deh_strlookup[i].ppstr, lookfor) : M_StringCompare(deh_strlookup[i].lookup, key))))
         {
             char    *t;
@@ -355,7 +355,7 @@ void D_Display(void)
             if (viewwidth != SCREENWIDTH)
                 R_DrawViewBorder();
 
-            if (r_detail == r_detail_low)
+            if (r_detail == r_detail_low && viewscale == 1)
                 postprocessfunc(screens[0], SCREENWIDTH, viewwindowx, viewwindowy * SCREENWIDTH,
                     viewwindowx + viewwidth, (viewwindowy + viewheight) * SCREENWIDTH,
                     lowpixelwidth, lowpixelheight);
@@ -423,6 +423,7 @@ void D_Display(void)
         // normal update
         blitfunc();
         mapblitfunc();
+        V_UpdateCapture();
 
         if (!vid_vsync)
         {
@@ -456,6 +457,7 @@ void D_Display(void)
 
         blitfunc();
         mapblitfunc();
+        V_UpdateCapture();
     } while (!done);
 }
 
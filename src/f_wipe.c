@@ -40,24 +40,20 @@
 // SCREEN WIPE PACKAGE
 //
 
-static int      y[MAXWIDTH];
-static short    src[MAXSCREENAREA];
-
-static void Wipe_ShittyColMajorXform(short *dest)
+typedef struct
 {
-    for (int yy = 0; yy < SCREENHEIGHT; yy++)
-        for (int xx = 0; xx < SCREENWIDTH / 2; xx++)
-            src[yy + xx * SCREENHEIGHT] = dest[yy * SCREENWIDTH / 2 + xx];
+    int left;
+    int size;
+    int prevy;
+    int y;
+} meltrun_t;
 
-    memcpy(dest, src, SCREENAREA);
-}
+static int          y[MAXWIDTH];
+static int          prevy[MAXWIDTH];
+static meltrun_t    meltruns[MAXWIDTH];
 
 static void Wipe_InitMelt(void)
 {
-    // makes this wipe faster (in theory) to have stuff in column-major format
-    Wipe_ShittyColMajorXform((short *)screens[2]);
-    Wipe_ShittyColMajorXform((short *)screens[3]);
-
     // setup initial column positions (y < 0 => not ready to scroll yet)
     y[0] = y[1] = -(M_BigRandom() & 15);
 
@@ -65,42 +61,73 @@ static void Wipe_InitMelt(void)
         y[i] = y[i + 1] = BETWEEN(-15, y[i - 1] + M_BigRandom() % 3 - 1, 0);
 }
 
-static void Wipe_Melt(const int i, const int dy)
+//
+// Wipe_Melt
+// Each column is 2 pixels wide. For those that moved this tic, rows prevy[i] to
+// y[i] - 1 are revealed from the end screen, and the start screen is drawn from
+// row y[i] down. Neighboring columns that moved the same way are grouped into
+// runs. The screens stay row-major, and are walked one row at a time, copying
+// each run as a single row segment.
+//
+static void Wipe_Melt(const int top)
 {
-    short   *s = &((short *)screens[3])[i * SCREENHEIGHT + y[i]];
-    short   *d = &((short *)screens[0])[y[i] * SCREENWIDTH / 2 + i];
+    const int   width = SCREENWIDTH / 2;
+    const short *startscreen = (short *)screens[2];
+    const short *endscreen = (short *)screens[3] + top * width;
+    short       *dest = (short *)screens[0] + top * width;
+    int         nummeltruns = 0;
 
-    for (int j = 0, k = dy; k > 0; k--, j += SCREENWIDTH / 2)
-        d[j] = *s++;
+    for (int i = 0, j; i < width; i = j)
+    {
+        for (j = i + 1; j < width && prevy[j] == prevy[i] && y[j] == y[i]; j++);
+
+        if (prevy[i] < SCREENHEIGHT)
+        {
+            meltrun_t   *run = &meltruns[nummeltruns++];
+
+            run->left = i;
+            run->size = (j - i) * sizeof(short);
+            run->prevy = prevy[i];
+            run->y = y[i];
+        }
+    }
 
-    y[i] += dy;
-    s = &((short *)screens[2])[i * SCREENHEIGHT];
-    d = &((short *)screens[0])[y[i] * SCREENWIDTH / 2 + i];
+    for (int yy = top; yy < SCREENHEIGHT; yy++, dest += width, endscreen += width)
+        for (int i = 0; i < nummeltruns; i++)
+        {
+            const meltrun_t *run = &meltruns[i];
 
-    for (int j = 0, k = SCREENHEIGHT - y[i]; k > 0; k--, j += SCREENWIDTH / 2)
-        d[j] = *s++;
+            if (yy >= run->y)
+                memcpy(dest + run->left, &startscreen[(yy - run->y) * width + run->left], run->size);
+            else if (yy >= run->prevy)
+                memcpy(dest + run->left, endscreen + run->left, run->size);
+        }
 }
 
 static bool Wipe_DoMelt(void)
 {
     bool    done = true;
+    int     top = SCREENHEIGHT;
 
     for (int i = 0; i < SCREENWIDTH / 2; i++)
+    {
+        prevy[i] = SCREENHEIGHT;
+
         if (y[i] < 0)
         {
             y[i]++;
             done = false;
         }
-        else if (y[i] < 16)
-        {
-            Wipe_Melt(i, y[i] + 1);
-            done = false;
-        }
         else if (y[i] < SCREENHEIGHT)
         {
-            Wipe_Melt(i, MIN(SCREENHEIGHT / 16, SCREENHEIGHT - y[i]));
+            prevy[i] = y[i];
+            top = MIN(top, y[i]);
+            y[i] += (y[i] < 16 ? y[i] + 1 : MIN(SCREENHEIGHT / 16, SCREENHEIGHT - y[i]));
             done = false;
         }
+    }
+
+    Wipe_Melt(top);
 
     return done;
 }
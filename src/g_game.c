@@ -612,6 +612,8 @@ void G_DoLoadLevel(void)
     if (viewplayer->playerstate == PST_DEAD)
         viewplayer->playerstate = PST_REBORN;
 
+    G_ClearRewind();
+
     viewplayer->damageinflicted = 0;
     viewplayer->damagereceived = 0;
     viewplayer->cheated = 0;
@@ -879,6 +881,11 @@ bool G_Responder(const event_t *ev)
                 keydown = key;
                 G_ToggleAlwaysRun(ev_keydown);
             }
+            else if ((key == keyboardrewind || key == keyboardrewind2) && !keydown && !menuactive)
+            {
+                keydown = key;
+                G_Rewind(1);
+            }
             else if (key < NUMKEYS)
             {
                 gamekeydown[key] = true;
@@ -995,6 +1002,387 @@ bool G_Responder(const event_t *ev)
     }
 }
 
+//
+// G_RestoredMap
+// Called once the current map has been restored from a savegame or a rewind
+// snapshot.
+//
+static void G_RestoredMap(void)
+{
+    if (musinfo.currentitem != -1)
+        S_ChangeMusInfoMusic(musinfo.currentitem, true);
+
+    if (setsizeneeded)
+        R_ExecuteSetViewSize();
+
+    // draw the pattern into the back screen
+    if (viewwidth != SCREENWIDTH)
+        R_FillBackScreen();
+
+    st_facecount = 0;
+
+    ammohighlight = 0;
+    armorhighlight = 0;
+    healthhighlight = 0;
+
+    ammodiff[am_clip] = 0;
+    ammodiff[am_shell] = 0;
+    ammodiff[am_misl] = 0;
+    ammodiff[am_cell] = 0;
+    armordiff = 0;
+    healthdiff = 0;
+
+    if (r_screensize == r_screensize_max && animatedstats)
+        P_AnimateAllStatsFromStart();
+}
+
+//
+// REWIND
+// A snapshot of the current map is taken every second. Only the newest is
+// kept whole. Each older one is kept as the run-length encoded XOR of it
+// and the snapshot taken after it, so that any of them can be rebuilt by
+// working back from the newest.
+//
+#define REWINDINTERVAL      TICRATE
+#define REWINDSNAPSHOTS     60
+#define REWINDMEMORY        (64 * 1024 * 1024)
+
+// changed bytes closer together than this are encoded as one run
+#define REWINDRUNGAP        8
+
+// the least of a delta encoded each tic after its snapshot is taken
+#define REWINDENCODECHUNK   32768
+
+typedef struct
+{
+    int         maptime;
+    size_t      length;
+    byte        *delta;
+    size_t      deltalength;
+} rewind_t;
+
+static rewind_t rewinds[REWINDSNAPSHOTS];
+static int      newestrewind;
+static int      numrewinds;
+
+static byte     *rewindstate;
+static size_t   rewindstatelength;
+static int      rewindstatemaptime = -1;
+
+// the snapshot before the newest, kept whole until the delta between the two
+// has been encoded over the tics that follow
+static byte     *rewindolderstate;
+static size_t   rewindolderstatelength;
+static size_t   rewindencodepos;
+static size_t   rewindencoderunend;
+
+static byte     *rewinddelta;
+static size_t   rewinddeltalength;
+static size_t   rewinddeltamax;
+
+int             numrewindsnapshots;
+int             rewindseconds;
+size_t          rewindmemory;
+
+static void G_FreeOldestRewind(void)
+{
+    rewind_t    *rewind = &rewinds[(newestrewind - numrewinds + 1 + REWINDSNAPSHOTS) % REWINDSNAPSHOTS];
+
+    rewindmemory -= rewind->deltalength;
+    free(rewind->delta);
+    rewind->delta = NULL;
+    numrewinds--;
+}
+
+//
+// G_ClearRewind
+// Called when a map is loaded.
+//
+void G_ClearRewind(void)
+{
+    while (numrewinds)
+        G_FreeOldestRewind();
+
+    free(rewindolderstate);
+    rewindolderstate = NULL;
+    rewindolderstatelength = 0;
+
+    free(rewindstate);
+    rewindstate = NULL;
+    rewindstatelength = 0;
+    rewindstatemaptime = -1;
+    rewindmemory = 0;
+    numrewindsnapshots = 0;
+}
+
+static void G_WriteRewindByte(const byte value)
+{
+    if (rewinddeltalength == rewinddeltamax)
+        rewinddelta = I_Realloc(rewinddelta, (rewinddeltamax = MAX(65536, rewinddeltamax * 2)));
+
+    rewinddelta[rewinddeltalength++] = value;
+}
+
+static void G_WriteRewindLength(size_t value)
+{
+    while (value >= 0x80)
+    {
+        G_WriteRewindByte((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+
+    G_WriteRewindByte((byte)value);
+}
+
+static size_t G_ReadRewindLength(const byte **delta)
+{
+    size_t  value = 0;
+    int     shift = 0;
+    byte    b;
+
+    do
+    {
+        b = *(*delta)++;
+        value |= (size_t)(b & 0x7F) << shift;
+        shift += 7;
+    } while (b & 0x80);
+
+    return value;
+}
+
+//
+// G_EncodeRewindDelta
+// Encodes the XOR of the snapshot before the newest and the newest as
+// alternating counts of unchanged and changed bytes, with the changed bytes
+// following their count. The shorter snapshot is treated as if it was padded
+// with zeros. Encoding stops once the given position is reached, and picks up
+// from there the next time.
+//
+static void G_EncodeRewindDelta(const size_t limit)
+{
+    const byte      *older = rewindolderstate;
+    const size_t    olderlength = rewindolderstatelength;
+    const byte      *newer = rewindstate;
+    const size_t    newerlength = rewindstatelength;
+    const size_t    length = MAX(olderlength, newerlength);
+    const size_t    stop = MIN(limit, length);
+    size_t          pos = rewindencodepos;
+
+#define XORBYTE(i) ((i < olderlength ? older[i] : 0) ^ (i < newerlength ? newer[i] : 0))
+
+    while (pos < stop)
+    {
+        size_t  start;
+        size_t  end;
+
+        while (pos < stop && !XORBYTE(pos))
+            pos++;
+
+        if (pos == stop)
+            break;
+
+        start = end = pos;
+
+        while (pos < length && pos - end < REWINDRUNGAP)
+        {
+            if (XORBYTE(pos))
+                end = pos + 1;
+
+            pos++;
+        }
+
+        G_WriteRewindLength(start - rewindencoderunend);
+        G_WriteRewindLength(end - start);
+
+        for (size_t i = start; i < end; i++)
+            G_WriteRewindByte(XORBYTE(i));
+
+        pos = rewindencoderunend = end;
+    }
+
+#undef XORBYTE
+
+    rewindencodepos = pos;
+}
+
+//
+// G_UpdateRewindDelta
+// Called every tic to encode the next part of the newest delta, or all of
+// what is left of it if it is needed now. Once it is done, the snapshot it
+// was encoded from is freed.
+//
+static void G_UpdateRewindDelta(const bool finish)
+{
+    size_t      length;
+    rewind_t    *rewind;
+
+    if (!rewindolderstate)
+        return;
+
+    length = MAX(rewindolderstatelength, rewindstatelength);
+
+    // always leave enough time to finish before the next snapshot is taken
+    G_EncodeRewindDelta(finish ? length :
+        rewindencodepos + MAX(REWINDENCODECHUNK, length / (REWINDINTERVAL / 2)));
+
+    if (rewindencodepos < length)
+        return;
+
+    newestrewind = (newestrewind + 1) % REWINDSNAPSHOTS;
+    rewind = &rewinds[newestrewind];
+    rewind->delta = I_Malloc(MAX(1, rewinddeltalength));
+    memcpy(rewind->delta, rewinddelta, rewinddeltalength);
+    rewind->deltalength = rewinddeltalength;
+    numrewinds++;
+
+    rewindmemory += rewind->deltalength - rewindolderstatelength;
+    free(rewindolderstate);
+    rewindolderstate = NULL;
+    rewindolderstatelength = 0;
+
+    while (rewindmemory > REWINDMEMORY && numrewinds)
+        G_FreeOldestRewind();
+
+    numrewindsnapshots = numrewinds + 1;
+}
+
+static void G_ApplyRewindDelta(byte *state, const rewind_t *rewind)
+{
+    const byte  *delta = rewind->delta;
+    const byte  *end = delta + rewind->deltalength;
+    size_t      pos = 0;
+
+    while (delta < end)
+    {
+        size_t  changed;
+
+        pos += G_ReadRewindLength(&delta);
+        changed = G_ReadRewindLength(&delta);
+
+        while (changed--)
+            state[pos++] ^= *delta++;
+    }
+}
+
+//
+// G_TakeRewindSnapshot
+// Only the snapshot is taken now. The delta between it and the one before is
+// encoded by G_UpdateRewindDelta() over the tics that follow.
+//
+static void G_TakeRewindSnapshot(void)
+{
+    size_t  length;
+    byte    *state = P_WriteSnapshot(&length);
+
+    G_UpdateRewindDelta(true);
+
+    if (rewindstate)
+    {
+        rewind_t    *rewind;
+
+        if (numrewinds == REWINDSNAPSHOTS)
+            G_FreeOldestRewind();
+
+        rewind = &rewinds[(newestrewind + 1) % REWINDSNAPSHOTS];
+        rewind->maptime = rewindstatemaptime;
+        rewind->length = rewindstatelength;
+
+        rewindolderstate = rewindstate;
+        rewindolderstatelength = rewindstatelength;
+        rewindencodepos = 0;
+        rewindencoderunend = 0;
+        rewinddeltalength = 0;
+    }
+
+    rewindstate = state;
+    rewindstatelength = length;
+    rewindstatemaptime = maptime;
+    rewindmemory += length;
+    numrewindsnapshots = numrewinds + 1 + !!rewindolderstate;
+}
+
+//
+// G_Rewind
+// Rewinds the current map to the newest snapshot taken at least the given
+// number of seconds ago, or to the oldest snapshot if there isn't one.
+//
+void G_Rewind(const int seconds)
+{
+    rewindseconds = MAX(1, seconds);
+    gameaction = ga_rewind;
+}
+
+static void G_DoRewind(void)
+{
+    const int   target = maptime - rewindseconds * TICRATE;
+    int         steps = 0;
+    size_t      length = rewindstatelength;
+    size_t      maxlength = rewindstatelength;
+    byte        *state;
+    int         seconds;
+    char        *temp1;
+    char        *temp2;
+
+    gameaction = ga_nothing;
+
+    G_UpdateRewindDelta(true);
+
+    if (!rewindstate)
+    {
+        C_Warning(0, "There is nothing to rewind to yet.");
+        return;
+    }
+
+    if (rewindstatemaptime > target)
+        while (steps < numrewinds)
+        {
+            const rewind_t  *rewind = &rewinds[(newestrewind - steps++ + REWINDSNAPSHOTS) % REWINDSNAPSHOTS];
+
+            maxlength = MAX(maxlength, rewind->length);
+
+            if (rewind->maptime <= target)
+                break;
+        }
+
+    // work back from the newest snapshot, dropping each one that is undone
+    state = calloc(1, maxlength);
+    memcpy(state, rewindstate, rewindstatelength);
+
+    for (int i = 0; i < steps; i++)
+    {
+        rewind_t    *rewind = &rewinds[newestrewind];
+
+        G_ApplyRewindDelta(state, rewind);
+        length = rewind->length;
+        rewindstatemaptime = rewind->maptime;
+
+        rewindmemory -= rewind->deltalength;
+        free(rewind->delta);
+        rewind->delta = NULL;
+        newestrewind = (newestrewind - 1 + REWINDSNAPSHOTS) % REWINDSNAPSHOTS;
+        numrewinds--;
+    }
+
+    seconds = (maptime - rewindstatemaptime) / TICRATE;
+
+    rewindmemory += length - rewindstatelength;
+    free(rewindstate);
+    rewindstate = state;
+    rewindstatelength = length;
+    numrewindsnapshots = numrewinds + 1;
+
+    P_ReadSnapshot(rewindstate, rewindstatelength);
+    G_RestoredMap();
+
+    temp1 = commify(numrewindsnapshots);
+    temp2 = commify(rewindmemory / 1024);
+    C_Output("The current map was rewound by %i second%s.", seconds, (seconds == 1 ? "" : "s"));
+    C_Output("There %s now %s snapshot%s to rewind to, using %s KB of memory.",
+        (numrewindsnapshots == 1 ? "is" : "are"), temp1, (numrewindsnapshots == 1 ? "" : "s"), temp2);
+    free(temp1);
+    free(temp2);
+}
+
 //
 // G_Ticker
 // Make ticcmd_ts for the players.
@@ -1048,6 +1436,10 @@ void G_Ticker(void)
                 G_DoWorldDone();
                 break;
 
+            case ga_rewind:
+                G_DoRewind();
+                break;
+
             default:
                 break;
         }
@@ -1117,10 +1509,19 @@ void G_Ticker(void)
             ST_Ticker();
             AM_Ticker();
             HU_Ticker();
+
+            if (!(maptime % REWINDINTERVAL)
+                && maptime != rewindstatemaptime
+                && viewplayer->playerstate == PST_LIVE)
+                G_TakeRewindSnapshot();
+            else
+                G_UpdateRewindDelta(false);
+
             break;
 
         case GS_INTERMISSION:
             WI_Ticker();
+            P_PrefetchTicker();
             break;
 
         case GS_FINALE:
@@ -1326,6 +1727,43 @@ int G_GetParTime(void)
         return 0;
 }
 
+//
+// G_FinaleIsNext
+// Returns true if G_WorldDone() will go to a finale once the intermission
+// is over.
+//
+static bool G_FinaleIsNext(void)
+{
+    if (*P_GetInterText(gameepisode, gamemap)
+        || (*P_GetInterSecretText(gameepisode, gamemap) && secretexit)
+        || P_GetMapEndCast(gameepisode, gamemap)
+        || P_GetMapEndGame(gameepisode, gamemap))
+        return true;
+
+    if (gamemode == commercial)
+    {
+        if (gamemission == pack_nerve)
+            return (gamemap == 8);
+
+        switch (gamemap)
+        {
+            case 15:
+            case 31:
+                return secretexit;
+
+            case 6:
+            case 11:
+            case 20:
+            case 30:
+                return true;
+        }
+
+        return false;
+    }
+
+    return (gamemap == 8);
+}
+
 static void G_DoCompleted(void)
 {
     const int   nextmap = P_GetMapNext(gameepisode, gamemap);
@@ -1470,6 +1908,10 @@ static void G_DoCompleted(void)
             wminfo.next = gamemap;      // go to next level
     }
 
+    // start reading in the next map while the intermission is showing
+    if (!G_FinaleIsNext())
+        P_PrefetchLevel(gameepisode, wminfo.next + 1);
+
     wminfo.maxkills = totalkills;
     wminfo.maxitems = totalitems;
     wminfo.maxsecret = totalsecrets;
@@ -1606,9 +2048,6 @@ void G_DoLoadGame(void)
 
     P_MapEnd();
 
-    if (musinfo.currentitem != -1)
-        S_ChangeMusInfoMusic(musinfo.currentitem, true);
-
     if (!P_ReadSaveGameEOF())
         I_Error("%s is invalid.", savename);
 
@@ -1616,14 +2055,7 @@ void G_DoLoadGame(void)
 
     fclose(save_stream);
 
-    if (setsizeneeded)
-        R_ExecuteSetViewSize();
-
-    // draw the pattern into the back screen
-    if (viewwidth != SCREENWIDTH)
-        R_FillBackScreen();
-
-    st_facecount = 0;
+    G_RestoredMap();
 
     if (gamemode != commercial)
     {
@@ -1643,20 +2075,6 @@ void G_DoLoadGame(void)
         C_Output(BOLD("%s") " loaded.", savename);
         C_HideConsoleFast();
     }
-
-    ammohighlight = 0;
-    armorhighlight = 0;
-    healthhighlight = 0;
-
-    ammodiff[am_clip] = 0;
-    ammodiff[am_shell] = 0;
-    ammodiff[am_misl] = 0;
-    ammodiff[am_cell] = 0;
-    armordiff = 0;
-    healthdiff = 0;
-
-    if (r_screensize == r_screensize_max && animatedstats)
-        P_AnimateAllStatsFromStart();
 }
 
 void G_LoadedGameMessage(void)
@@ -104,6 +104,14 @@ void G_RemoveChoppers(void);
 
 void G_LoadedGameMessage(void);
 
+// Keep snapshots of the current map to rewind to.
+void G_ClearRewind(void);
+void G_Rewind(const int seconds);
+
+extern int          numrewindsnapshots;
+extern int          rewindseconds;
+extern size_t       rewindmemory;
+
 extern fixed_t      forwardmove[2];
 extern fixed_t      sidemove[2];
 extern fixed_t      angleturn[3];
@@ -33,17 +33,19 @@
 ==============================================================================
 */
 
+#include <string.h>
+
 #include "SDL_mixer.h"
 
 #include "c_console.h"
 #include "doomstat.h"
+#include "i_system.h"
 #include "i_winmusic.h"
 #include "m_config.h"
 #include "memio.h"
 #include "mus2mid.h"
 #include "s_sound.h"
 #include "w_wad.h"
-#include "z_zone.h"
 
 bool        midimusictype;
 bool        musmusictype;
@@ -58,6 +60,19 @@ static bool music_initialized;
 
 int         current_music_volume = 0;
 
+// MUS lumps converted to MIDI, kept for the rest of the game
+typedef struct
+{
+    int             lumpnum;
+    unsigned int    hash;
+    byte            *mid;
+    int             midlen;
+} cachedsong_t;
+
+static cachedsong_t *cachedsongs;
+static int          numcachedsongs;
+static int          maxcachedsongs;
+
 // Shutdown music
 void I_ShutdownMusic(void)
 {
@@ -71,6 +86,14 @@ void I_ShutdownMusic(void)
 
     Mix_CloseAudio();
 
+    for (int i = 0; i < numcachedsongs; i++)
+        free(cachedsongs[i].mid);
+
+    free(cachedsongs);
+    cachedsongs = NULL;
+    numcachedsongs = 0;
+    maxcachedsongs = 0;
+
 #if defined(_WIN32)
     if (windowsmidi)
     {
@@ -212,7 +235,68 @@ void I_UnregisterSong(void *handle)
 #endif
 }
 
-void *I_RegisterSong(void *data, int size)
+// FNV-1a hash of a lump's contents
+static unsigned int I_HashSong(const byte *data, const int size)
+{
+    unsigned int    hash = 2166136261u;
+
+    for (int i = 0; i < size; i++)
+        hash = (hash ^ data[i]) * 16777619u;
+
+    return hash;
+}
+
+//
+// I_GetCachedSong
+// Returns the MIDI conversion of a MUS lump, only running mus2mid() the
+// first time a lump is played. Returns NULL if the lump can't be converted.
+//
+static cachedsong_t *I_GetCachedSong(void *data, const int size, const int lumpnum)
+{
+    const unsigned int  hash = I_HashSong(data, size);
+    MEMFILE             *instream;
+    MEMFILE             *outstream;
+    cachedsong_t        *song = NULL;
+
+    for (int i = 0; i < numcachedsongs; i++)
+        if (cachedsongs[i].lumpnum == lumpnum && cachedsongs[i].hash == hash)
+            return &cachedsongs[i];
+
+    instream = mem_fopen_read(data, size);
+    outstream = mem_fopen_write();
+
+    if (mus2mid(instream, outstream))
+    {
+        void    *outbuf;
+        size_t  midlen;
+
+        mem_get_buf(outstream, &outbuf, &midlen);
+
+        if (numcachedsongs == maxcachedsongs)
+            cachedsongs = I_Realloc(cachedsongs, (maxcachedsongs = MAX(maxcachedsongs * 2, 16)) * sizeof(*cachedsongs));
+
+        song = &cachedsongs[numcachedsongs++];
+        song->lumpnum = lumpnum;
+        song->hash = hash;
+        song->mid = I_Malloc(midlen);
+        song->midlen = (int)midlen;
+        memcpy(song->mid, outbuf, midlen);
+    }
+
+    mem_fclose(instream);
+    mem_fclose(outstream);
+
+    return song;
+}
+
+// Convert a MUS lump ahead of time so it's ready when it's played
+void I_PrecacheSong(void *data, int size, int lumpnum)
+{
+    if (music_initialized && W_LumpFormat(lumpnum) == LUMP_MUS)
+        I_GetCachedSong(data, size, lumpnum);
+}
+
+void *I_RegisterSong(void *data, int size, int lumpnum)
 {
     if (!music_initialized)
         return NULL;
@@ -231,30 +315,16 @@ void *I_RegisterSong(void *data, int size)
                 midimusictype = true;
             else if (!memcmp(data, "MUS\x1A", 4))   // is it a MUS?
             {
-                MEMFILE *instream = mem_fopen_read(data, size);
-                MEMFILE *outstream = mem_fopen_write();
+                const cachedsong_t  *song = I_GetCachedSong(data, size, lumpnum);
 
                 musmusictype = true;
 
-                if (mus2mid(instream, outstream))
+                if (song)
                 {
-                    void    *outbuf;
-                    byte    *mid;
-                    size_t  midlen;
-
-                    mem_get_buf(outstream, &outbuf, &midlen);
-
-                    if ((mid = Z_Malloc(midlen, PU_LEVEL, NULL)))
-                    {
-                        memcpy(mid, outbuf, midlen);
-                        data = mid;
-                        size = (int)midlen;
-                    }
+                    data = song->mid;
+                    size = song->midlen;
                 }
 
-                mem_fclose(instream);
-                mem_fclose(outstream);
-
                 midimusictype = true;               // now it's a MIDI
             }
         }
@@ -47,6 +47,7 @@
 #include "m_config.h"
 #include "m_misc.h"
 #include "s_sound.h"
+#include "v_video.h"
 #include "version.h"
 #include "w_wad.h"
 
@@ -225,6 +226,8 @@ void I_Quit(bool shutdown)
 
         M_SaveCVARs();
 
+        V_ShutdownScreenShots();
+
         I_ShutdownKeyboard();
         I_ShutdownController();
         SDL_Quit();
@@ -1037,6 +1037,20 @@ void I_SetPalette(const byte *playpal)
         SDL_SetRenderDrawColor(renderer, colors[0].r, colors[0].g, colors[0].b, SDL_ALPHA_OPAQUE);
 }
 
+//
+// I_GetPalette
+// Copy the palette currently in use, once gamma correction and the like have been applied.
+//
+void I_GetPalette(byte *playpal)
+{
+    for (int i = 0; i < 256; i++)
+    {
+        *playpal++ = colors[i].r;
+        *playpal++ = colors[i].g;
+        *playpal++ = colors[i].b;
+    }
+}
+
 void I_SetExternalAutomapPalette(void)
 {
     if (mapwindow)
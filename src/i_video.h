@@ -101,6 +101,7 @@ void GetScreenResolution(void);
 
 // Takes full 8 bit values.
 void I_SetPalette(const byte *playpal);
+void I_GetPalette(byte *playpal);
 void I_SetExternalAutomapPalette(void);
 
 void I_UpdateBlitFunc(const bool shaking);
@@ -122,6 +122,7 @@ bool        m_novertical = m_novertical_default;
 bool        m_pointer = m_pointer_default;
 float       m_sensitivity = m_sensitivity_default;
 bool        melt = melt_default;
+int         mem_cachebudget = mem_cachebudget_default;
 bool        menuhighlight = menuhighlight_default;
 bool        menushadow = menushadow_default;
 bool        menuspin = menuspin_default;
@@ -141,6 +142,7 @@ int         r_bloodsplats_max = r_bloodsplats_max_default;
 int         r_bloodsplats_total;
 bool        r_bloodsplats_translucency = r_bloodsplats_translucency_default;
 bool        r_brightmaps = r_brightmaps_default;
+bool        r_columnmajor = r_columnmajor_default;
 bool        r_corpses_color = r_corpses_color_default;
 bool        r_corpses_gib = r_corpses_gib_default;
 bool        r_corpses_mirrored = r_corpses_mirrored_default;
@@ -222,6 +224,7 @@ int         vid_saturation = vid_saturation_default;
 char        *vid_scaleapi = vid_scaleapi_default;
 char        *vid_scalefilter = vid_scalefilter_default;
 char        *vid_screenresolution = vid_screenresolution_default;
+int         vid_screenshotcompression = vid_screenshotcompression_default;
 bool        vid_showfps = vid_showfps_default;
 int         vid_vsync = vid_vsync_default;
 bool        vid_widescreen = vid_widescreen_default;
@@ -367,6 +370,7 @@ static default_t cvars[] =
     CVAR_BOOL         (m_pointer,                        m_pointer,                             m_pointer,                             BOOLVALUEALIAS     ),
     CVAR_FLOAT        (m_sensitivity,                    m_sensitivity,                         m_sensitivity,                         NOVALUEALIAS       ),
     CVAR_BOOL         (melt,                             wipe,                                  melt,                                  BOOLVALUEALIAS     ),
+    CVAR_INT          (mem_cachebudget,                  mem_cachebudget,                       mem_cachebudget,                       NOVALUEALIAS       ),
     CVAR_BOOL         (menuhighlight,                    menuhighlight,                         menuhighlight,                         BOOLVALUEALIAS     ),
     CVAR_BOOL         (menushadow,                       menushadow,                            menushadow,                            BOOLVALUEALIAS     ),
     CVAR_BOOL         (menuspin,                         menuspin,                              menuspin,                              BOOLVALUEALIAS     ),
@@ -385,6 +389,7 @@ static default_t cvars[] =
     CVAR_INT          (r_bloodsplats_max,                r_bloodsplats_max,                     r_bloodsplats_max,                     NOVALUEALIAS       ),
     CVAR_BOOL         (r_bloodsplats_translucency,       r_bloodsplats_translucency,            r_bloodsplats_translucency,            BOOLVALUEALIAS     ),
     CVAR_BOOL         (r_brightmaps,                     r_brightmaps,                          r_brightmaps,                          BOOLVALUEALIAS     ),
+    CVAR_BOOL         (r_columnmajor,                    r_columnmajor,                         r_columnmajor,                         BOOLVALUEALIAS     ),
     CVAR_BOOL         (r_corpses_color,                  r_corpses_colour,                      r_corpses_color,                       BOOLVALUEALIAS     ),
     CVAR_BOOL         (r_corpses_gib,                    r_corpses_gib,                         r_corpses_gib,                         BOOLVALUEALIAS     ),
     CVAR_BOOL         (r_corpses_mirrored,               r_corpses_mirrored,                    r_corpses_mirrored,                    BOOLVALUEALIAS     ),
@@ -466,6 +471,7 @@ static default_t cvars[] =
     CVAR_STRING       (vid_scaleapi,                     vid_scaleapi,                          vid_scaleapi,                          NOVALUEALIAS       ),
     CVAR_STRING       (vid_scalefilter,                  vid_scalefilter,                       vid_scalefilter,                       NOVALUEALIAS       ),
     CVAR_OTHER        (vid_screenresolution,             vid_screenresolution,                  vid_screenresolution,                  NOVALUEALIAS       ),
+    CVAR_INT          (vid_screenshotcompression,        vid_screenshotcompression,             vid_screenshotcompression,             NOVALUEALIAS       ),
     CVAR_INT          (vid_vsync,                        vid_vsync,                             vid_vsync,                             VSYNCVALUEALIAS    ),
     CVAR_BOOL         (vid_widescreen,                   vid_widescreen,                        vid_widescreen,                        BOOLVALUEALIAS     ),
     CVAR_OTHER        (vid_windowpos,                    vid_windowposition,                    vid_windowpos,                         NOVALUEALIAS       ),
@@ -113,6 +113,7 @@ extern bool     m_novertical;
 extern bool     m_pointer;
 extern float    m_sensitivity;
 extern bool     melt;
+extern int      mem_cachebudget;
 extern bool     menuhighlight;
 extern bool     menushadow;
 extern bool     menuspin;
@@ -132,6 +133,7 @@ extern int      r_bloodsplats_max;
 extern int      r_bloodsplats_total;
 extern bool     r_bloodsplats_translucency;
 extern bool     r_brightmaps;
+extern bool     r_columnmajor;
 extern bool     r_corpses_color;
 extern bool     r_corpses_gib;
 extern bool     r_corpses_mirrored;
@@ -213,6 +215,7 @@ extern int      vid_saturation;
 extern char     *vid_scaleapi;
 extern char     *vid_scalefilter;
 extern char     *vid_screenresolution;
+extern int      vid_screenshotcompression;
 extern bool     vid_showfps;
 extern int      vid_vsync;
 extern bool     vid_widescreen;
@@ -583,6 +586,10 @@ enum
 
 #define melt_default                        true
 
+#define mem_cachebudget_min                 0
+#define mem_cachebudget_default             64
+#define mem_cachebudget_max                 1024
+
 #define menuhighlight_default               true
 
 #define menushadow_default                  true
@@ -633,6 +640,8 @@ enum
 
 #define r_brightmaps_default                true
 
+#define r_columnmajor_default               false
+
 #define r_corpses_color_default             true
 
 #define r_corpses_gib_default               true
@@ -855,6 +864,10 @@ enum
 #define vid_screenresolution_desktop        "desktop"
 #define vid_screenresolution_default        vid_screenresolution_desktop
 
+#define vid_screenshotcompression_min       0
+#define vid_screenshotcompression_default   6
+#define vid_screenshotcompression_max       10
+
 #define vid_showfps_default                 false
 
 #if defined(__APPLE__)
@@ -955,6 +968,8 @@ enum
 #define KEYNEXTWEAPON2_DEFAULT              0
 #define KEYPREVWEAPON_DEFAULT               0
 #define KEYPREVWEAPON2_DEFAULT              0
+#define KEYREWIND_DEFAULT                   KEY_BACKSPACE
+#define KEYREWIND2_DEFAULT                  0
 #define KEYRIGHT_DEFAULT                    KEY_RIGHTARROW
 #define KEYRIGHT2_DEFAULT                   0
 #define KEYROTATEMODE_DEFAULT               'r'
@@ -69,6 +69,8 @@ int keyboardnextweapon = KEYNEXTWEAPON_DEFAULT;
 int keyboardnextweapon2 = KEYNEXTWEAPON2_DEFAULT;
 int keyboardprevweapon = KEYPREVWEAPON_DEFAULT;
 int keyboardprevweapon2 = KEYPREVWEAPON2_DEFAULT;
+int keyboardrewind = KEYREWIND_DEFAULT;
+int keyboardrewind2 = KEYREWIND2_DEFAULT;
 int keyboardright = KEYRIGHT_DEFAULT;
 int keyboardright2 = KEYRIGHT2_DEFAULT;
 int keyboardrotatemode = KEYROTATEMODE_DEFAULT;
@@ -71,6 +71,8 @@ extern int  keyboardnextweapon;
 extern int  keyboardnextweapon2;
 extern int  keyboardprevweapon;
 extern int  keyboardprevweapon2;
+extern int  keyboardrewind;
+extern int  keyboardrewind2;
 extern int  keyboardright;
 extern int  keyboardright2;
 extern int  keyboardrotatemode;
@@ -461,43 +461,131 @@ menu_t SaveDef =
     load1
 };
 
+//
+// M_GrayMenuBackgroundRow
+// Tint (if it's every 4th row), gray and blur horizontally a row of src into dest.
+//
+static void M_GrayMenuBackgroundRow(const byte *src, byte *dest, const byte *white)
+{
+    if (white)
+        for (int x = 0; x < SCREENWIDTH; x++)
+            dest[x] = grays[white[src[x]]];
+    else
+        for (int x = 0; x < SCREENWIDTH; x++)
+            dest[x] = grays[src[x]];
+
+    for (int x = 0; x <= SCREENWIDTH - 2; x++)
+        dest[x] = tinttab50[(dest[x + 1] << 8) + dest[x]];
+
+    for (int x = SCREENWIDTH - 2; x > 0; x--)
+        dest[x] = tinttab50[(dest[x - 1] << 8) + dest[x]];
+}
+
+//
+// M_BlurMenuBackground
+// Tint, gray, blur and darken src into dest in 3 passes rather than 11. Each row
+// is grayed just before the row 2 above it is blurred with its neighbors, while
+// they are all still in the cache.
+//
 static void M_BlurMenuBackground(const byte *src, byte *dest)
 {
-    for (int i = 0; i < SCREENAREA; i++)
-        dest[i] = grays[src[i]];
+    static const byte   *whites[MAXHEIGHT / 4 + 1];
+    static byte         rowbuffer[4][MAXWIDTH];
+    byte                *rowbuffers[4] = { rowbuffer[0], rowbuffer[1], rowbuffer[2], rowbuffer[3] };
+    byte                *above;
+    byte                *below;
 
-    for (int y = 0; y <= SCREENAREA - SCREENWIDTH; y += SCREENWIDTH)
-        for (int x = y; x <= y + SCREENWIDTH - 2; x++)
-            dest[x] = tinttab50[(dest[x + 1] << 8) + dest[x]];
+    // choose the tint of each 4th row before the blur calls M_BigRandomInt()
+    for (int y = 2; y < SCREENHEIGHT; y += 4)
+        whites[y / 4] = ((M_BigRandom() % 25) ? white25 : white33);
 
-    for (int y = 0; y <= SCREENAREA - SCREENWIDTH; y += SCREENWIDTH)
-        for (int x = y + SCREENWIDTH - 2; x > y; x--)
-            dest[x] = tinttab50[(dest[x - 1] << 8) + dest[x]];
+    // the blur of each row can reach the first pixel 2 rows below it
+    for (int row = 0, y = 0; row < 3; row++, y += SCREENWIDTH)
+        M_GrayMenuBackgroundRow(src + y, dest + y, (row == 2 ? whites[0] : NULL));
+
+    for (int row = 1, y = SCREENWIDTH; y <= SCREENAREA - SCREENWIDTH * 2; row++, y += SCREENWIDTH)
+    {
+        if (y <= SCREENAREA - SCREENWIDTH * 3)
+            M_GrayMenuBackgroundRow(src + y + SCREENWIDTH * 2, dest + y + SCREENWIDTH * 2,
+                ((row + 2) % 4 == 2 ? whites[(row + 2) / 4] : NULL));
 
-    for (int y = SCREENWIDTH; y <= SCREENAREA - SCREENWIDTH * 2; y += SCREENWIDTH)
         for (int x = y + 6; x <= y + SCREENWIDTH - 6; x++)
             dest[x] = tinttab50[(dest[SCREENWIDTH * M_BigRandomInt(-1, 1)
                 + x + M_BigRandomInt(-6, 6)] << 8) + dest[x]];
+    }
 
-    for (int y = SCREENAREA - SCREENWIDTH; y >= SCREENWIDTH; y -= SCREENWIDTH)
-        for (int x = y + SCREENWIDTH - 1; x >= y + 1; x--)
-            dest[x] = tinttab50[(dest[x - SCREENWIDTH - 1] << 8) + dest[x]];
+    // Blur each row with the one above and to the left of it, and then with the
+    // one below it. Keeping a copy of each row from before the first of these
+    // lets both be done in the same pass.
+    above = rowbuffers[0];
+    below = rowbuffers[1];
+    memcpy(above, dest, SCREENWIDTH);
 
     for (int y = 0; y <= SCREENAREA - SCREENWIDTH * 2; y += SCREENWIDTH)
-        for (int x = y; x <= y + SCREENWIDTH - 1; x++)
-            dest[x] = tinttab50[(dest[x + SCREENWIDTH] << 8) + dest[x]];
+    {
+        byte    *row = dest + y;
+        byte    *next = row + SCREENWIDTH;
+        byte    *temp;
 
-    for (int y = SCREENAREA - SCREENWIDTH; y >= SCREENWIDTH; y -= SCREENWIDTH)
-        for (int x = y; x <= y + SCREENWIDTH - 1; x++)
-            dest[x] = tinttab50[(dest[x - SCREENWIDTH] << 8) + dest[x]];
+        memcpy(below, next, SCREENWIDTH);
 
-    for (int y = 0; y <= SCREENAREA - SCREENWIDTH * 2; y += SCREENWIDTH)
-        for (int x = y + SCREENWIDTH - 1; x >= y + 1; x--)
-            dest[x] = tinttab50[(dest[x + SCREENWIDTH - 1] << 8) + dest[x]];
+        for (int x = SCREENWIDTH - 1; x >= 1; x--)
+            next[x] = tinttab50[(above[x - 1] << 8) + next[x]];
+
+        for (int x = 0; x < SCREENWIDTH; x++)
+            row[x] = tinttab50[(next[x] << 8) + row[x]];
+
+        temp = above;
+        above = below;
+        below = temp;
+    }
+
+    // Then, also in the same pass, blur each row with the one above it, then with
+    // the one below and to the left of it, then with the one above and to the
+    // right of it, and darken it.
+    memcpy(above, dest, SCREENWIDTH);
+
+    for (int y = 0; y < SCREENAREA; y += SCREENWIDTH)
+    {
+        byte    *row = dest + y;
+        byte    *temp;
+
+        if (y < SCREENAREA - SCREENWIDTH)
+        {
+            byte    *next = row + SCREENWIDTH;
+
+            memcpy(below, next, SCREENWIDTH);
+
+            for (int x = 0; x < SCREENWIDTH; x++)
+                next[x] = tinttab50[(above[x] << 8) + next[x]];
 
-    for (int y = SCREENAREA - SCREENWIDTH; y >= SCREENWIDTH; y -= SCREENWIDTH)
-        for (int x = y; x <= y + SCREENWIDTH - 2; x++)
-            dest[x] = tinttab50[(dest[x - SCREENWIDTH + 1] << 8) + dest[x]];
+            for (int x = SCREENWIDTH - 1; x >= 1; x--)
+                row[x] = tinttab50[(next[x - 1] << 8) + row[x]];
+
+            temp = above;
+            above = below;
+            below = temp;
+        }
+
+        memcpy(rowbuffers[3], row, SCREENWIDTH);
+
+        if (y)
+        {
+            const byte  *prev = rowbuffers[2];
+
+            for (int x = 0; x < SCREENWIDTH - 1; x++)
+                row[x] = black40[tinttab50[(prev[x + 1] << 8) + row[x]]];
+
+            row[SCREENWIDTH - 1] = black40[row[SCREENWIDTH - 1]];
+        }
+        else
+            for (int x = 0; x < SCREENWIDTH; x++)
+                row[x] = black40[row[x]];
+
+        temp = rowbuffers[2];
+        rowbuffers[2] = rowbuffers[3];
+        rowbuffers[3] = temp;
+    }
 }
 
 static void M_DrawMenuBorder(void)
@@ -540,27 +628,7 @@ void M_DrawMenuBackground(void)
 
     if (gametime != blurtic)
     {
-        for (int y = 2 * SCREENWIDTH; y < SCREENAREA; y += 4 * SCREENWIDTH)
-        {
-            const byte  *white = ((M_BigRandom() % 25) ? white25 : white33);
-
-            for (int x = 0; x < SCREENWIDTH; x++)
-            {
-                byte    *dot = *screens + x + y;
-
-                *dot = white[*dot];
-            }
-        }
-
         M_BlurMenuBackground(screens[0], blurscreen);
-
-        for (int i = 0; i < SCREENAREA; i++)
-        {
-            byte    *dot = blurscreen + i;
-
-            *dot = black40[*dot];
-        }
-
         blurtic = gametime;
     }
 
@@ -2406,6 +2474,7 @@ static void M_ChangeDetail(int choice)
     STLib_Init();
     R_InitColumnFunctions();
     AM_InitPixelSize();
+    setsizeneeded = true;
 }
 
 static void M_SizeDisplay(int choice)
@@ -637,6 +637,43 @@ bool M_StringEndsWith(const char *s, const char *suffix)
     return (len1 >= len2 && M_StringCompare(s + len1 - len2, suffix));
 }
 
+// Returns the number of single-character edits needed to turn string1 into string2.
+int M_LevenshteinDistance(const char *string1, const char *string2)
+{
+    const size_t    length1 = strlen(string1);
+    const size_t    length2 = strlen(string2);
+    int             result = INT_MAX;
+
+    if (length1 > 0 && length2 > 0)
+    {
+        int *column = malloc((length1 + 1) * sizeof(int));
+
+        if (column)
+        {
+            for (int y = 1; (size_t)y <= length1; y++)
+                column[y] = y;
+
+            for (int x = 1; (size_t)x <= length2; x++)
+            {
+                column[0] = x;
+
+                for (int y = 1, lastdiagonal = x - 1, olddiagonal; (size_t)y <= length1; y++)
+                {
+                    olddiagonal = column[y];
+                    column[y] = MIN(MIN(column[y], column[y - 1]) + 1,
+                        lastdiagonal + (string1[y - 1] != string2[x - 1]));
+                    lastdiagonal = olddiagonal;
+                }
+            }
+
+            result = column[length1];
+            free(column);
+        }
+    }
+
+    return result;
+}
+
 // Safe, portable vsnprintf().
 void M_vsnprintf(char *buf, int buf_len, const char *s, va_list args)
 {
@@ -1144,6 +1181,8 @@ void M_TranslateAutocomplete(void)
     else
         for (int i = 0; *autocompletelist[i].text; i++)
             M_AmericanToBritishEnglish(autocompletelist[i].text);
+
+    C_InvalidateAutocompleteIndex();
 }
 
 const char *dayofweek(int day, int month, int year)
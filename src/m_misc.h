@@ -85,6 +85,7 @@ char *M_TempFile(char *s);
 char *M_StringJoin(const char *s, ...);
 bool M_StringStartsWith(const char *s, const char *prefix);
 bool M_StringEndsWith(const char *s, const char *suffix);
+int M_LevenshteinDistance(const char *string1, const char *string2);
 void M_vsnprintf(char *buf, int buf_len, const char *s, va_list args);
 void M_snprintf(char *buf, int buf_len, const char *s, ...);
 char *M_SubString(const char *str, size_t begin, size_t len);
@@ -48,6 +48,7 @@
 #include "p_setup.h"
 #include "p_tick.h"
 #include "s_sound.h"
+#include "z_zone.h"
 
 #define DISTFRIEND  (128 * FRACUNIT)    // distance friends tend to move towards players
 #define BARRELRANGE (512 * FRACUNIT)
@@ -66,40 +67,114 @@ void A_Fall(mobj_t *actor, player_t *player, pspdef_t *psp);
 //
 
 //
-// P_RecursiveSound
-// Called by P_NoiseAlert.
-// Recursively traverse adjacent sectors,
-// sound blocking lines cut off traversal.
+// Sound propagation
+// The two-sided lines between each sector and its neighbors are gathered into
+// a compact graph when the map is loaded. P_NoiseAlert() then floods it
+// breadth-first from the sector the noise was made in, instead of recursing
+// into a sector every time it's reached through a line, first across lines
+// that don't block sound, and then across at most one line that does.
 //
-// killough 05/05/98: reformatted, cleaned up
-//
-static void P_RecursiveSound(sector_t *sec, const int soundblocks, mobj_t *soundtarget)
+typedef struct
+{
+    sector_t    *sector;
+    line_t      *line;
+} soundedge_t;
+
+static soundedge_t  *soundedges;
+static int          *firstsoundedge;
+static sector_t     **soundqueue;
+static sector_t     **soundblockedqueue;
+
+static int          noisealerttime;
+static sector_t     *noisealertsector;
+static mobj_t       *noisealerttarget;
+
+void P_InitSoundGraph(void)
 {
-    // wake up all monsters in this sector
-    if (sec->validcount == validcount && sec->soundtraversed <= soundblocks + 1)
-        return;         // already flooded
+    int numsoundedges = 0;
+
+    for (int i = 0; i < numsectors; i++)
+        for (int j = 0; j < sectors[i].linecount; j++)
+            if (sectors[i].lines[j]->sidenum[1] != NO_INDEX)
+                numsoundedges++;
+
+    soundedges = Z_Malloc(MAX(1, numsoundedges) * sizeof(*soundedges), PU_LEVEL, NULL);
+    firstsoundedge = Z_Malloc((numsectors + 1) * sizeof(*firstsoundedge), PU_LEVEL, NULL);
+    soundqueue = Z_Malloc(numsectors * sizeof(*soundqueue), PU_LEVEL, NULL);
+    soundblockedqueue = Z_Malloc(numsectors * sizeof(*soundblockedqueue), PU_LEVEL, NULL);
+    numsoundedges = 0;
+
+    for (int i = 0; i < numsectors; i++)
+    {
+        sector_t    *sec = sectors + i;
+
+        firstsoundedge[i] = numsoundedges;
+
+        for (int j = 0; j < sec->linecount; j++)
+        {
+            line_t  *line = sec->lines[j];
+
+            if (line->sidenum[1] != NO_INDEX)
+            {
+                soundedges[numsoundedges].sector = sides[line->sidenum[(sides[line->sidenum[0]].sector == sec)]].sector;
+                soundedges[numsoundedges++].line = line;
+            }
+        }
+    }
+
+    firstsoundedge[numsectors] = numsoundedges;
+
+    noisealerttime = -1;
+    noisealertsector = NULL;
+    noisealerttarget = NULL;
+}
 
+static void P_WakeSector(sector_t *sec, const int soundtraversed, mobj_t *soundtarget)
+{
     sec->validcount = validcount;
-    sec->soundtraversed = soundblocks + 1;
+    sec->soundtraversed = soundtraversed;
     P_SetTarget(&sec->soundtarget, soundtarget);
+}
 
-    for (int i = 0; i < sec->linecount; i++)
+//
+// P_FloodSound
+// Wake up every sector reachable from those in soundqueue without crossing
+// a closed door or, when the flood has already crossed a line that blocks
+// sound, another such line.
+//
+static void P_FloodSound(int count, const int soundblocks, mobj_t *soundtarget, int *numblocked)
+{
+    for (int i = 0; i < count; i++)
     {
-        line_t      *line = sec->lines[i];
-        const int   flags = line->flags;
+        sector_t            *sec = soundqueue[i];
+        const soundedge_t   *edge = soundedges + firstsoundedge[sec->id];
+        const soundedge_t   *end = soundedges + firstsoundedge[sec->id + 1];
 
-        if (!(flags & ML_TWOSIDED))
-            continue;
+        for (; edge < end; edge++)
+        {
+            sector_t    *other = edge->sector;
+            const int   flags = edge->line->flags;
 
-        P_LineOpening(line);
+            if (!(flags & ML_TWOSIDED))
+                continue;
 
-        if (openrange <= 0)
-            continue;   // closed door
+            if (MIN(sec->ceilingheight, other->ceilingheight) <= MAX(sec->floorheight, other->floorheight))
+                continue;   // closed door
 
-        if (!(flags & ML_SOUNDBLOCK))
-            P_RecursiveSound(sides[line->sidenum[(sides[line->sidenum[0]].sector == sec)]].sector, soundblocks, soundtarget);
-        else if (!soundblocks)
-            P_RecursiveSound(sides[line->sidenum[(sides[line->sidenum[0]].sector == sec)]].sector, 1, soundtarget);
+            if (!(flags & ML_SOUNDBLOCK))
+            {
+                if (other->validcount != validcount || other->soundtraversed > soundblocks + 1)
+                {
+                    P_WakeSector(other, soundblocks + 1, soundtarget);
+                    soundqueue[count++] = other;
+                }
+            }
+            else if (!soundblocks && (other->validcount != validcount || other->soundtraversed > 2))
+            {
+                P_WakeSector(other, 2, soundtarget);
+                soundblockedqueue[(*numblocked)++] = other;
+            }
+        }
     }
 }
 
@@ -110,12 +185,34 @@ static void P_RecursiveSound(sector_t *sec, const int soundblocks, mobj_t *sound
 //
 void P_NoiseAlert(mobj_t *target)
 {
+    sector_t    *sec = target->subsector->sector;
+    int         count = 0;
+    int         numblocked = 0;
+
     // [BH] don't alert if notarget CCMD is enabled
     if (target->player && (viewplayer->cheats & CF_NOTARGET))
         return;
 
+    // the same noise was already made from here this tic
+    if (maptime == noisealerttime && sec == noisealertsector && target == noisealerttarget && sec->soundtarget == target)
+        return;
+
+    noisealerttime = maptime;
+    noisealertsector = sec;
+    noisealerttarget = target;
+
     validcount++;
-    P_RecursiveSound(target->subsector->sector, 0, target);
+    P_WakeSector(sec, 1, target);
+    soundqueue[0] = sec;
+    P_FloodSound(1, 0, target, &numblocked);
+
+    // then carry on past the lines that block sound, from the sectors not
+    // since reached without crossing one
+    for (int i = 0; i < numblocked; i++)
+        if (soundblockedqueue[i]->soundtraversed == 2)
+            soundqueue[count++] = soundblockedqueue[i];
+
+    P_FloodSound(count, 1, target, &numblocked);
 }
 
 //
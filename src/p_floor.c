@@ -58,6 +58,7 @@ result_e T_MovePlane(sector_t *sector, const fixed_t speed, fixed_t dest,
             {
                 sector->oldfloorheight = sector->floorheight;
                 sector->oldfloorgametime = gametime;
+                R_AddMovingSector(sector);
             }
 
             switch (direction)
@@ -121,6 +122,7 @@ result_e T_MovePlane(sector_t *sector, const fixed_t speed, fixed_t dest,
             {
                 sector->oldceilingheight = sector->ceilingheight;
                 sector->oldceilinggametime = gametime;
+                R_AddMovingSector(sector);
             }
 
             switch (direction)
@@ -134,6 +134,15 @@ void P_AnimateMaxAmmo(const int diff, const ammotype_t type);
 
 extern int  numfriends;
 
+extern int  livemobjs;
+extern int  peakmobjs;
+extern int  totalmobjs;
+
+extern bloodsplat_t *bloodsplats;
+extern int          maxbloodsplats;
+extern int          oldestbloodsplat;
+extern int          numbloodsplats;
+
 void P_RespawnSpecials(void);
 
 void P_SetPlayerViewHeight(void);
@@ -141,6 +150,9 @@ void P_SetPlayerViewHeight(void);
 void P_LookForCards(void);
 void P_InitCards(void);
 
+void P_ClearMobjs(void);
+mobj_t *P_AllocMobj(void);
+void P_FreeMobj(mobj_t *mobj);
 mobj_t *P_SpawnMobj(const fixed_t x, const fixed_t y, const fixed_t z, const mobjtype_t type);
 void P_SetShadowColumnFunction(mobj_t *mobj);
 mobjtype_t P_FindDoomedNum(const int type);
@@ -159,6 +171,7 @@ void P_SpawnPuff(const fixed_t x, const fixed_t y, const fixed_t z, const angle_
 void P_SpawnSmokeTrail(const fixed_t x, const fixed_t y, const fixed_t z, const angle_t angle);
 void P_SpawnBlood(const fixed_t x, const fixed_t y, const fixed_t z, angle_t angle, const int damage, mobj_t *target);
 void P_SetBloodSplatColor(bloodsplat_t *splat);
+bloodsplat_t *P_NewBloodSplat(void);
 void P_SpawnBloodSplat(const fixed_t x, const fixed_t y, const int color, const bool usemaxheight,
     const bool checklineside, const fixed_t maxheight, mobj_t *target);
 bool P_CheckMissileSpawn(mobj_t *th);
@@ -177,6 +190,7 @@ bool P_SeekerMissile(mobj_t *actor, mobj_t **seektarget, angle_t thresh, angle_t
 extern uint64_t shake;
 extern int      shakeduration;
 
+void P_InitSoundGraph(void);
 void P_NoiseAlert(mobj_t *target);
 bool P_CheckMeleeRange(mobj_t *actor);
 
@@ -2290,33 +2290,52 @@ static void PIT_ChangeSector(mobj_t *thing)
 // sector. Both more accurate and faster.
 // [BH] renamed from P_CheckSector to P_ChangeSector to replace old one entirely
 //
+// Things touching the sector are gathered up front, in the order they are
+// in its list, and each one still touching the sector when its turn comes is
+// then processed. This visits them in the same order as restarting the scan
+// from the head of the list after each one, as was done before, but without
+// that being quadratic in the number of things. The gathered things are kept
+// on a stack so nested calls don't disturb each other.
+//
+static mobj_t   **changesectorthings;
+static int      numchangesectorthings;
+static int      maxchangesectorthings;
+
+static bool P_IsTouchingSector(const mobj_t *thing, const sector_t *sector)
+{
+    for (const msecnode_t *node = thing->touching_sectorlist; node; node = node->m_tnext)
+        if (node->m_sector == sector)
+            return true;
+
+    return false;
+}
+
 bool P_ChangeSector(sector_t *sector, const bool crunch)
 {
-    msecnode_t  *n;
+    const int   first = numchangesectorthings;
 
     nofit = false;
     crushchange = crunch;
 
-    // Mark all things invalid
-    for (n = sector->touching_thinglist; n; n = n->m_snext)
-        n->visited = false;
-
-    do
+    for (msecnode_t *n = sector->touching_thinglist; n; n = n->m_snext)
     {
-        for (n = sector->touching_thinglist; n; n = n->m_snext) // go through list
-            if (!n->visited)                                    // unprocessed thing found
-            {
-                mobj_t  *mobj = n->m_thing;
+        if (numchangesectorthings == maxchangesectorthings)
+            changesectorthings = I_Realloc(changesectorthings,
+                (maxchangesectorthings = MAX(256, maxchangesectorthings * 2)) * sizeof(*changesectorthings));
 
-                n->visited = true;                              // mark thing as processed
+        changesectorthings[numchangesectorthings++] = n->m_thing;
+    }
 
-                if (mobj && !(mobj->flags & MF_NOBLOCKMAP))
-                    PIT_ChangeSector(mobj);                     // process it
+    for (int i = first; i < numchangesectorthings; i++)
+    {
+        mobj_t  *mobj = changesectorthings[i];
 
-                break;                                          // exit and start over
-            }
-    } while (n);    // repeat from scratch until all things left are marked valid
+        // skip things removed or moved out of the sector by an earlier one
+        if (mobj && !(mobj->flags & MF_NOBLOCKMAP) && P_IsTouchingSector(mobj, sector))
+            PIT_ChangeSector(mobj);
+    }
 
+    numchangesectorthings = first;
     return nofit;
 }
 
@@ -233,6 +233,9 @@ void P_UnsetBloodSplatPosition(bloodsplat_t *splat)
     if ((*prev = next))
         next->prev = prev;
 
+    // free its slot in the pool
+    splat->sector = NULL;
+
     r_bloodsplats_total--;
 }
 
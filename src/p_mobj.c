@@ -40,6 +40,7 @@
 #include "doomstat.h"
 #include "g_game.h"
 #include "hu_stuff.h"
+#include "i_system.h"
 #include "m_config.h"
 #include "m_misc.h"
 #include "m_random.h"
@@ -768,12 +769,106 @@ void P_SetShadowColumnFunction(mobj_t *mobj)
         mobj->shadowcolfunc = (r_shadows_translucency ? &R_DrawShadowColumn : &R_DrawSolidShadowColumn);
 }
 
+//
+// MOBJ POOL
+// Map objects are carved out of slabs of cache-line-aligned slots rather
+// than allocated one at a time, and are put back on a free list once
+// P_RemoveThinkerDelayed() finds that nothing references them any longer.
+// All slots are freed again at the start of each map.
+//
+#define MOBJSPERSLAB    512
+#define CACHELINESIZE   64
+#define MOBJSLOTSIZE    ((sizeof(mobj_t) + CACHELINESIZE - 1) & ~(CACHELINESIZE - 1))
+
+static byte     **mobjslabs;
+static int      nummobjslabs;
+static int      maxmobjslabs;
+static mobj_t   *freemobjs;
+
+int             livemobjs;
+int             peakmobjs;
+int             totalmobjs;
+
+static byte *P_MobjSlot(const int slab, const int i)
+{
+    // align the start of each slab to a cache line
+    return (byte *)(((uintptr_t)mobjslabs[slab] + CACHELINESIZE - 1) & ~(uintptr_t)(CACHELINESIZE - 1))
+        + i * MOBJSLOTSIZE;
+}
+
+//
+// P_ClearMobjs
+// Returns every slot to the free list, in address order so that things
+// spawned when a map is loaded end up next to each other.
+//
+void P_ClearMobjs(void)
+{
+    freemobjs = NULL;
+
+    for (int slab = nummobjslabs - 1; slab >= 0; slab--)
+        for (int i = MOBJSPERSLAB - 1; i >= 0; i--)
+        {
+            mobj_t  *mobj = (mobj_t *)P_MobjSlot(slab, i);
+
+            mobj->thinker.next = (thinker_t *)freemobjs;
+            freemobjs = mobj;
+        }
+
+    livemobjs = 0;
+    peakmobjs = 0;
+}
+
+//
+// P_AllocMobj
+//
+mobj_t *P_AllocMobj(void)
+{
+    mobj_t  *mobj;
+
+    if (!freemobjs)
+    {
+        const int   slab = nummobjslabs;
+
+        if (nummobjslabs == maxmobjslabs)
+            mobjslabs = I_Realloc(mobjslabs, (maxmobjslabs = (maxmobjslabs ? maxmobjslabs * 2 : 16)) * sizeof(*mobjslabs));
+
+        mobjslabs[nummobjslabs++] = I_Malloc(MOBJSPERSLAB * MOBJSLOTSIZE + CACHELINESIZE - 1);
+
+        for (int i = MOBJSPERSLAB - 1; i >= 0; i--)
+        {
+            mobj = (mobj_t *)P_MobjSlot(slab, i);
+            mobj->thinker.next = (thinker_t *)freemobjs;
+            freemobjs = mobj;
+        }
+
+        totalmobjs += MOBJSPERSLAB;
+    }
+
+    mobj = freemobjs;
+    freemobjs = (mobj_t *)mobj->thinker.next;
+
+    if (++livemobjs > peakmobjs)
+        peakmobjs = livemobjs;
+
+    return memset(mobj, 0, sizeof(*mobj));
+}
+
+//
+// P_FreeMobj
+//
+void P_FreeMobj(mobj_t *mobj)
+{
+    mobj->thinker.next = (thinker_t *)freemobjs;
+    freemobjs = mobj;
+    livemobjs--;
+}
+
 //
 // P_SpawnMobj
 //
 mobj_t *P_SpawnMobj(const fixed_t x, const fixed_t y, const fixed_t z, const mobjtype_t type)
 {
-    mobj_t      *mobj = Z_Calloc(1, sizeof(*mobj), PU_LEVEL, NULL);
+    mobj_t      *mobj = P_AllocMobj();
     mobjinfo_t  *info = &mobjinfo[type];
     state_t     *st = &states[info->spawnstate];
     sector_t    *sector;
@@ -903,17 +998,30 @@ void P_RemoveBloodMobj(mobj_t *mobj)
     }
 
     // free block
-    P_RemoveThinker2((thinker_t *)mobj);
+    P_RemoveThinker((thinker_t *)mobj);
 }
 
+// blood splats are kept in a ring, oldest first
+bloodsplat_t        *bloodsplats;
+int                 maxbloodsplats;
+int                 oldestbloodsplat;
+int                 numbloodsplats;
+
 //
 // P_RemoveBloodSplats
 //
 void P_RemoveBloodSplats(void)
 {
-    for (int i = 0; i < numsectors; i++)
-        for (bloodsplat_t *splat = sectors[i].splatlist; splat; splat = splat->next)
+    for (int i = 0; i < numbloodsplats; i++)
+    {
+        bloodsplat_t    *splat = &bloodsplats[(oldestbloodsplat + i) % maxbloodsplats];
+
+        if (splat->sector)
             P_UnsetBloodSplatPosition(splat);
+    }
+
+    oldestbloodsplat = 0;
+    numbloodsplats = 0;
 }
 
 //
@@ -1401,7 +1509,7 @@ mobj_t *P_SpawnMapThing(mapthing_t *mthing, const bool spawnmonsters)
 //
 void P_SpawnPuff(const fixed_t x, const fixed_t y, const fixed_t z, const angle_t angle)
 {
-    mobj_t      *th = Z_Calloc(1, sizeof(*th), PU_LEVEL, NULL);
+    mobj_t      *th = P_AllocMobj();
     mobjinfo_t  *info = &mobjinfo[MT_PUFF];
     state_t     *st = &states[info->spawnstate];
     sector_t    *sector;
@@ -1483,7 +1591,7 @@ void P_SpawnBlood(const fixed_t x, const fixed_t y, const fixed_t z, angle_t ang
 
         for (int i = (damage >> 2) + 1; i > 0; i--)
         {
-            mobj_t      *th = Z_Calloc(1, sizeof(*th), PU_LEVEL, NULL);
+            mobj_t      *th = P_AllocMobj();
             sector_t    *sector;
 
             th->type = MT_BLOOD;
@@ -1575,13 +1683,82 @@ void P_SetBloodSplatColor(bloodsplat_t *splat)
     }
 }
 
+//
+// P_GrowBloodSplats
+// Moves the live blood splats, oldest first, into a larger pool and relinks
+// them so each sector's list keeps its newest splat at the head. Once the
+// pool can't grow any more, this just closes up the holes left by removed
+// splats.
+//
+static void P_GrowBloodSplats(void)
+{
+    const int       newmax = MIN(MAX(maxbloodsplats * 2, 1024), r_bloodsplats_max);
+    bloodsplat_t    *newbloodsplats = I_Malloc(newmax * sizeof(*newbloodsplats));
+    int             count = 0;
+
+    for (int i = 0; i < numsectors; i++)
+        sectors[i].splatlist = NULL;
+
+    for (int i = 0; i < numbloodsplats; i++)
+    {
+        bloodsplat_t    *splat = &bloodsplats[(oldestbloodsplat + i) % maxbloodsplats];
+
+        if (splat->sector)
+        {
+            newbloodsplats[count] = *splat;
+            P_SetBloodSplatPosition(&newbloodsplats[count++]);
+        }
+    }
+
+    free(bloodsplats);
+    bloodsplats = newbloodsplats;
+    maxbloodsplats = newmax;
+    oldestbloodsplat = 0;
+    numbloodsplats = count;
+}
+
+//
+// P_NewBloodSplat
+// Returns a free slot at the new end of the blood splat pool. Once
+// r_bloodsplats_max is reached, the oldest splats are recycled.
+//
+bloodsplat_t *P_NewBloodSplat(void)
+{
+    if (!r_bloodsplats_max)
+        return NULL;
+
+    // skip over splats at the old end that have already been removed
+    while (numbloodsplats && !bloodsplats[oldestbloodsplat].sector)
+    {
+        oldestbloodsplat = (oldestbloodsplat + 1) % maxbloodsplats;
+        numbloodsplats--;
+    }
+
+    // recycle the oldest splats still in the map until there is room for one more
+    while (numbloodsplats && r_bloodsplats_total >= r_bloodsplats_max)
+    {
+        bloodsplat_t    *splat = &bloodsplats[oldestbloodsplat];
+
+        if (splat->sector)
+            P_UnsetBloodSplatPosition(splat);
+
+        oldestbloodsplat = (oldestbloodsplat + 1) % maxbloodsplats;
+        numbloodsplats--;
+    }
+
+    if (numbloodsplats == maxbloodsplats)
+        P_GrowBloodSplats();
+
+    return &bloodsplats[(oldestbloodsplat + numbloodsplats++) % maxbloodsplats];
+}
+
 //
 // P_SpawnBloodSplat
 //
 void P_SpawnBloodSplat(const fixed_t x, const fixed_t y, const int color, const bool usemaxheight,
     const bool checklineside, const fixed_t maxheight, mobj_t *target)
 {
-    if (r_bloodsplats_total < r_bloodsplats_max)
+    if (r_bloodsplats_max)
     {
         sector_t    *sec = R_PointInSubsector(x, y)->sector;
 
@@ -1589,7 +1766,7 @@ void P_SpawnBloodSplat(const fixed_t x, const fixed_t y, const int color, const
             && (!usemaxheight || sec->interpfloorheight <= maxheight)
             && (!checklineside || !P_CheckLineSide(target, x, y)))
         {
-            bloodsplat_t    *splat = malloc(sizeof(*splat));
+            bloodsplat_t    *splat = P_NewBloodSplat();
 
             if (splat)
             {
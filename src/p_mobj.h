@@ -500,6 +500,9 @@ typedef struct mobj_s
     int                 id;
     int                 musicid;
 
+    // index of the thing in the last savegame written or read
+    int                 saveindex;
+
     char                name[33];
 
     bool                madesound;
@@ -54,16 +54,23 @@
 #include "z_zone.h"
 
 #define SAVEGAME_EOF    0x1D
-#define TARGETLIMIT     4192
 
-FILE        *save_stream;
+// a thing in the order it's archived, and the indices of the things it points to
+typedef struct
+{
+    mobj_t          *mobj;
+    int             target;
+    int             tracer;
+    int             lastenemy;
+} savething_t;
+
+FILE                *save_stream;
 
-static int  thingindex;
-static int  targets[TARGETLIMIT];
-static int  tracers[TARGETLIMIT];
-static int  lastenemies[TARGETLIMIT];
-static int  soundtargets[TARGETLIMIT];
-static int  attacker;
+static savething_t  *savethings;
+static int          numsavethings;
+static int          maxsavethings;
+static int          *soundtargets;
+static int          attacker;
 
 // Get the filename of a temporary file to write the savegame to. After the
 // file has been successfully saved, it will be renamed to the real file.
@@ -93,11 +100,21 @@ char *P_SaveGameFile(int slot)
     return filename;
 }
 
+// Snapshots used to rewind the current map are written to and read from
+// this buffer rather than save_stream
+static byte     *snapshot;
+static size_t   snapshotpos;
+static size_t   snapshotlength;
+static size_t   snapshotmax;
+
 // Endian-safe integer read/write functions
 static byte saveg_read8(void)
 {
     byte    result;
 
+    if (snapshot)
+        return (snapshotpos < snapshotlength ? snapshot[snapshotpos++] : 0);
+
     if (fread(&result, 1, 1, save_stream) < 1)
         return 0;
 
@@ -106,7 +123,15 @@ static byte saveg_read8(void)
 
 static void saveg_write8(byte value)
 {
-    fwrite(&value, 1, 1, save_stream);
+    if (snapshot)
+    {
+        if (snapshotpos == snapshotmax)
+            snapshot = I_Realloc(snapshot, (snapshotmax *= 2));
+
+        snapshot[snapshotpos++] = value;
+    }
+    else
+        fwrite(&value, 1, 1, save_stream);
 }
 
 static short saveg_read16(void)
@@ -172,36 +197,47 @@ static void saveg_write_mapthing_t(const mapthing_t *str)
     saveg_write16(str->options);
 }
 
-static int P_ThingToIndex(const mobj_t *thing)
+static savething_t *P_NewSaveThing(void)
 {
-    int i = 0;
+    if (numsavethings == maxsavethings)
+        savethings = I_Realloc(savethings, (maxsavethings = MAX(maxsavethings * 2, 1024)) * sizeof(*savethings));
 
-    if (!thing)
-        return 0;
+    return &savethings[numsavethings];
+}
 
-    for (thinker_t *th = thinkers[th_mobj].cnext; th != &thinkers[th_mobj]; th = th->cnext)
-    {
-        i++;
+//
+// P_NumberThings
+// Gives each thing that will be archived its index before anything is
+// written, so that pointers to things can then be archived without
+// searching for them.
+//
+static void P_NumberThings(void)
+{
+    numsavethings = 0;
 
-        if ((mobj_t *)th == thing)
-            return i;
-    }
+    for (thinker_t *th = thinkers[th_mobj].cnext; th != &thinkers[th_mobj]; th = th->cnext)
+        if (th->function != &P_RemoveThinkerDelayed)
+        {
+            mobj_t  *mo = (mobj_t *)th;
 
-    return 0;
+            P_NewSaveThing()->mobj = mo;
+            mo->saveindex = ++numsavethings;
+        }
 }
 
-static mobj_t *P_IndexToThing(const int index)
+static int P_ThingToIndex(const mobj_t *thing)
 {
-    int i = 0;
+    int i;
 
-    if (!index)
-        return NULL;
+    if (!thing || (i = thing->saveindex) <= 0 || i > numsavethings || savethings[i - 1].mobj != thing)
+        return 0;
 
-    for (thinker_t *th = thinkers[th_mobj].cnext; th != &thinkers[th_mobj]; th = th->cnext)
-        if (++i == index)
-            return (mobj_t *)th;
+    return i;
+}
 
-    return NULL;
+static mobj_t *P_IndexToThing(const int index)
+{
+    return (index > 0 && index <= numsavethings ? savethings[index - 1].mobj : NULL);
 }
 
 //
@@ -234,7 +270,7 @@ static void saveg_read_mobj_t(mobj_t *str)
     str->health = saveg_read32();
     str->movedir = saveg_read32();
     str->movecount = saveg_read32();
-    targets[thingindex] = saveg_read32();
+    savethings[numsavethings].target = saveg_read32();
     str->reactiontime = saveg_read32();
     str->threshold = saveg_read32();
 
@@ -245,8 +281,8 @@ static void saveg_read_mobj_t(mobj_t *str)
     }
 
     saveg_read_mapthing_t(&str->spawnpoint);
-    tracers[thingindex] = saveg_read32();
-    lastenemies[thingindex] = saveg_read32();
+    savethings[numsavethings].tracer = saveg_read32();
+    savethings[numsavethings].lastenemy = saveg_read32();
     str->floatbob = saveg_read32();
     str->shadowoffset = saveg_read32();
     str->gear = saveg_read16();
@@ -1130,6 +1166,7 @@ void P_ReadSaveGameFooter(void)
 //
 void P_ArchivePlayer(void)
 {
+    P_NumberThings();
     saveg_write_player_t();
 }
 
@@ -1212,6 +1249,8 @@ void P_UnarchiveWorld(void)
     sector_t    *sector = sectors;
     line_t      *line = lines;
 
+    soundtargets = I_Realloc(soundtargets, MAX(numsectors, 1) * sizeof(*soundtargets));
+
     // do sectors
     for (int i = 0; i < numsectors; i++, sector++)
     {
@@ -1221,6 +1260,9 @@ void P_UnarchiveWorld(void)
         if (ABS((sector->ceilingheight = saveg_read32())) < FRACUNIT)
             sector->ceilingheight <<= FRACBITS;
 
+        sector->interpfloorheight = sector->floorheight;
+        sector->interpceilingheight = sector->ceilingheight;
+
         sector->floorpic = saveg_read16();
         sector->terraintype = terraintypes[sector->floorpic];
         sector->ceilingpic = saveg_read16();
@@ -1230,7 +1272,7 @@ void P_UnarchiveWorld(void)
         sector->tag = saveg_read16();
         sector->ceilingdata = NULL;
         sector->floordata = NULL;
-        soundtargets[MIN(i, TARGETLIMIT - 1)] = saveg_read32();
+        soundtargets[i] = saveg_read32();
 
         // [BH] For future features without breaking savegame compatibility
         saveg_read32();
@@ -1302,13 +1344,17 @@ void P_ArchiveThinkers(void)
             saveg_write_mobj_t((mobj_t *)th);
         }
 
-    // save off the bloodsplats
-    for (int i = 0; i < numsectors; i++)
-        for (bloodsplat_t *splat = sectors[i].splatlist; splat; splat = splat->next)
+    // save off the bloodsplats, oldest first so they are relinked in the same order
+    for (int i = 0; i < numbloodsplats; i++)
+    {
+        bloodsplat_t    *splat = &bloodsplats[(oldestbloodsplat + i) % maxbloodsplats];
+
+        if (splat->sector)
         {
             saveg_write8(tc_bloodsplat);
             saveg_write_bloodsplat_t(splat);
         }
+    }
 
     // add a terminating marker
     saveg_write8(tc_end);
@@ -1339,11 +1385,15 @@ void P_UnarchiveThinkers(void)
     {
         thinker_t   *next = th->next;
 
+        // map objects go back to the mobj pool whatever still references them,
+        // since every thinker is about to be thrown away anyway
         if (th->function == &P_MobjThinker || th->function == &MusInfoThinker)
         {
             P_RemoveMobj((mobj_t *)th);
-            P_RemoveThinkerDelayed(th);
+            P_FreeMobj((mobj_t *)th);
         }
+        else if (th->function == &P_RemoveThinkerDelayed)
+            P_FreeMobj((mobj_t *)th);
         else
             Z_Free(th);
 
@@ -1352,7 +1402,7 @@ void P_UnarchiveThinkers(void)
 
     P_InitThinkers();
 
-    thingindex = 0;
+    numsavethings = 0;
 
     totalitems = viewplayer->itemcount;
     totalkills = viewplayer->killcount;
@@ -1366,9 +1416,11 @@ void P_UnarchiveThinkers(void)
         {
             case tc_mobj:
             {
-                mobj_t  *mobj = Z_Calloc(1, sizeof(*mobj), PU_LEVEL, NULL);
+                mobj_t  *mobj = P_AllocMobj();
 
+                P_NewSaveThing()->mobj = mobj;
                 saveg_read_mobj_t(mobj);
+                mobj->saveindex = ++numsavethings;
 
                 mobj->info = &mobjinfo[mobj->type];
                 P_SetThingPosition(mobj);
@@ -1379,7 +1431,6 @@ void P_UnarchiveThinkers(void)
                 mobj->colfunc = mobj->info->colfunc;
                 mobj->altcolfunc = mobj->info->altcolfunc;
                 P_SetShadowColumnFunction(mobj);
-                thingindex = MIN(thingindex + 1, TARGETLIMIT - 1);
 
                 if ((mobj->flags & MF_COUNTKILL)
                     && mobj->health > 0
@@ -1393,25 +1444,25 @@ void P_UnarchiveThinkers(void)
 
             case tc_bloodsplat:
             {
-                bloodsplat_t    *splat = malloc(sizeof(*splat));
+                bloodsplat_t    temp;
+                bloodsplat_t    *splat;
 
-                if (splat)
+                saveg_read_bloodsplat_t(&temp);
+
+                if ((splat = P_NewBloodSplat()))
                 {
-                    saveg_read_bloodsplat_t(splat);
-
-                    if (r_bloodsplats_total < r_bloodsplats_max)
-                    {
-                        if (splat->patch < firstbloodsplatlump || splat->patch >= firstbloodsplatlump + BLOODSPLATLUMPS)
-                            splat->patch = firstbloodsplatlump + (M_BigRandom() & (BLOODSPLATLUMPS - 1));
-
-                        splat->width = spritewidth[splat->patch];
-                        splat->patch += firstspritelump;
-                        P_SetBloodSplatColor(splat);
-                        splat->angle = M_BigSubRandom() * ANGLEMULTIPLIER;
-                        splat->sector = R_PointInSubsector(splat->x, splat->y)->sector;
-                        P_SetBloodSplatPosition(splat);
-                        r_bloodsplats_total++;
-                    }
+                    *splat = temp;
+
+                    if (splat->patch < firstbloodsplatlump || splat->patch >= firstbloodsplatlump + BLOODSPLATLUMPS)
+                        splat->patch = firstbloodsplatlump + (M_BigRandom() & (BLOODSPLATLUMPS - 1));
+
+                    splat->width = spritewidth[splat->patch];
+                    splat->patch += firstspritelump;
+                    P_SetBloodSplatColor(splat);
+                    splat->angle = M_BigSubRandom() * ANGLEMULTIPLIER;
+                    splat->sector = R_PointInSubsector(splat->x, splat->y)->sector;
+                    P_SetBloodSplatPosition(splat);
+                    r_bloodsplats_total++;
                 }
 
                 break;
@@ -1429,24 +1480,19 @@ void P_UnarchiveThinkers(void)
 
 void P_RestoreTargets(void)
 {
-    sector_t    *sec = sectors;
-    int         targetlimit = MIN(numsectors, TARGETLIMIT - 1);
-
     P_SetNewTarget(&viewplayer->attacker, P_IndexToThing(attacker));
 
-    for (int i = 0; i < targetlimit; i++, sec++)
-        P_SetNewTarget(&sec->soundtarget, P_IndexToThing(soundtargets[i]));
-
-    thingindex = 0;
+    for (int i = 0; i < numsectors; i++)
+        P_SetNewTarget(&sectors[i].soundtarget, P_IndexToThing(soundtargets[i]));
 
-    for (thinker_t *th = thinkers[th_mobj].cnext; th != &thinkers[th_mobj]; th = th->cnext)
+    for (int i = 0; i < numsavethings; i++)
     {
-        mobj_t  *mo = (mobj_t *)th;
+        const savething_t   *thing = &savethings[i];
+        mobj_t              *mo = thing->mobj;
 
-        P_SetNewTarget(&mo->target, P_IndexToThing(targets[thingindex]));
-        P_SetNewTarget(&mo->tracer, P_IndexToThing(tracers[thingindex]));
-        P_SetNewTarget(&mo->lastenemy, P_IndexToThing(lastenemies[thingindex]));
-        thingindex = MIN(thingindex + 1, TARGETLIMIT - 1);
+        P_SetNewTarget(&mo->target, P_IndexToThing(thing->target));
+        P_SetNewTarget(&mo->tracer, P_IndexToThing(thing->tracer));
+        P_SetNewTarget(&mo->lastenemy, P_IndexToThing(thing->lastenemy));
     }
 }
 
@@ -1707,6 +1753,72 @@ void P_UnarchiveSpecials(void)
     }
 }
 
+//
+// P_WriteSnapshot
+// Archives the state of the current map the same way a savegame does, but
+// into a buffer. The buffer is returned and must be freed by the caller.
+//
+byte *P_WriteSnapshot(size_t *length)
+{
+    byte    *buffer;
+
+    snapshot = I_Malloc((snapshotmax = 65536));
+    snapshotpos = 0;
+
+    saveg_write32(maptime);
+    P_ArchivePlayer();
+    P_ArchiveWorld();
+    P_ArchiveThinkers();
+    P_ArchiveSpecials();
+    P_ArchiveMap();
+
+    buffer = snapshot;
+    *length = snapshotpos;
+    snapshot = NULL;
+
+    return buffer;
+}
+
+//
+// P_ReadSnapshot
+// Restores the current map to the state archived by P_WriteSnapshot().
+//
+void P_ReadSnapshot(byte *buffer, const size_t length)
+{
+    snapshot = buffer;
+    snapshotpos = 0;
+    snapshotlength = length;
+
+    // the map objects making these sounds are about to be freed
+    S_StopSounds();
+
+    P_RemoveAllActiveCeilings();
+    P_RemoveAllActivePlats();
+
+    for (int i = 0; i < maxbuttons; i++)
+        memset(&buttonlist[i], 0, sizeof(button_t));
+
+    P_RemoveBloodSplats();
+
+    maptime = saveg_read32();
+    P_UnarchivePlayer();
+    P_UnarchiveWorld();
+    P_UnarchiveThinkers();
+    P_UnarchiveSpecials();
+    P_UnarchiveMap();
+    P_RestoreTargets();
+    P_MapEnd();
+
+    // don't interpolate sectors from where they were before
+    for (int i = 0; i < numsectors; i++)
+    {
+        sectors[i].oldfloorheight = sectors[i].floorheight;
+        sectors[i].oldceilingheight = sectors[i].ceilingheight;
+    }
+
+    snapshot = NULL;
+}
+
 //
 // P_ArchiveMap
 //
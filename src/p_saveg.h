@@ -98,4 +98,7 @@ void P_UnarchiveMap(void);
 
 void P_RestoreTargets(void);
 
+byte *P_WriteSnapshot(size_t *length);
+void P_ReadSnapshot(byte *buffer, const size_t length);
+
 extern FILE *save_stream;
@@ -43,6 +43,7 @@
 #include "doomstat.h"
 #include "i_swap.h"
 #include "i_system.h"
+#include "i_timer.h"
 #include "m_argv.h"
 #include "m_bbox.h"
 #include "m_config.h"
@@ -385,6 +386,15 @@ bool            secretmap;
 
 nodeformat_t    nodeformat;
 
+static int      prefetchlumpnum = -1;
+static int      prefetchepisode;
+static int      prefetchmap;
+static int      prefetchstep;
+static int      *prefetchlumps;
+static int      numprefetchlumps;
+static byte     *prefetchznodes;
+static int      prefetchznodeslump = -1;
+
 const char *nodeformats[] =
 {
     "Vanilla",
@@ -1654,6 +1664,56 @@ static void P_LoadNodes_V4(int lump)
     W_ReleaseLumpNum(lump);
 }
 
+// Decompress a ZNOD lump into a newly allocated buffer
+static byte *P_InflateZNodes(int lump)
+{
+    byte        *data = W_CacheLumpNum(lump);
+    const int   len = W_LumpLength(lump);
+    byte        *output;
+    int         outlen;
+    int         err;
+    z_stream    *zstream;
+
+    // first estimate for compression rate:
+    // output buffer size == input size * 2.5
+    outlen = (int)(len * 2.5);
+    output = I_Malloc(outlen);
+
+    // initialize stream state for decompression
+    zstream = I_Malloc(sizeof(*zstream));
+    memset(zstream, 0, sizeof(*zstream));
+    zstream->next_in = data + 4;
+    zstream->avail_in = len - 4;
+    zstream->next_out = output;
+    zstream->avail_out = outlen;
+
+    if (inflateInit(zstream) != Z_OK)
+        I_Error("P_LoadZNodes: Error during ZNOD nodes decompression initialization!");
+
+    // resize if output buffer runs full
+    while ((err = inflate(zstream, Z_SYNC_FLUSH)) == Z_OK)
+    {
+        int outlen_old = outlen;
+
+        outlen = outlen_old * 2;
+        output = I_Realloc(output, outlen);
+        zstream->next_out = output + outlen_old;
+        zstream->avail_out = outlen - outlen_old;
+    }
+
+    if (err != Z_STREAM_END)
+        I_Error("P_LoadZNodes: Error during ZNOD nodes decompression!");
+
+    if (inflateEnd(zstream) != Z_OK)
+        I_Error("P_LoadZNodes: Error during ZNOD nodes decompression shutdown!");
+
+    // release the original data lump
+    W_ReleaseLumpNum(lump);
+    free(zstream);
+
+    return output;
+}
+
 // MB 2020-03-01: Fix endianness for 32-bit ZDoom nodes
 // <https://zdoom.org/wiki/Node#ZDoom_extended_nodes>
 static void P_LoadZSegs(const byte *data)
@@ -1741,7 +1801,7 @@ static void P_LoadZSegs(const byte *data)
 // <https://zdoom.org/wiki/Node#ZDoom_extended_nodes>
 static void P_LoadZNodes(int lump, bool compressed)
 {
-    byte            *data = W_CacheLumpNum(lump);
+    byte            *data;
     byte            *output = NULL;
     unsigned int    orgVerts;
     unsigned int    newVerts;
@@ -1753,54 +1813,22 @@ static void P_LoadZNodes(int lump, bool compressed)
 
     if (compressed)
     {
-        const int   len = W_LumpLength(lump);
-        int         outlen;
-        int         err;
-        z_stream    *zstream;
-
-        // first estimate for compression rate:
-        // output buffer size == input size * 2.5
-        outlen = (int)(len * 2.5);
-        output = I_Malloc(outlen);
-
-        // initialize stream state for decompression
-        zstream = I_Malloc(sizeof(*zstream));
-        memset(zstream, 0, sizeof(*zstream));
-        zstream->next_in = data + 4;
-        zstream->avail_in = len - 4;
-        zstream->next_out = output;
-        zstream->avail_out = outlen;
-
-        if (inflateInit(zstream) != Z_OK)
-            I_Error("P_LoadZNodes: Error during ZNOD nodes decompression initialization!");
-
-        // resize if output buffer runs full
-        while ((err = inflate(zstream, Z_SYNC_FLUSH)) == Z_OK)
+        // use the nodes inflated during the intermission if there are any
+        if (lump == prefetchznodeslump)
         {
-            int outlen_old = outlen;
-
-            outlen = outlen_old * 2;
-            output = I_Realloc(output, outlen);
-            zstream->next_out = output + outlen_old;
-            zstream->avail_out = outlen - outlen_old;
+            output = prefetchznodes;
+            prefetchznodes = NULL;
+            prefetchznodeslump = -1;
         }
-
-        if (err != Z_STREAM_END)
-            I_Error("P_LoadZNodes: Error during ZNOD nodes decompression!");
+        else
+            output = P_InflateZNodes(lump);
 
         data = output;
-
-        if (inflateEnd(zstream) != Z_OK)
-            I_Error("P_LoadZNodes: Error during ZNOD nodes decompression shutdown!");
-
-        // release the original data lump
-        W_CacheLumpNum(lump);
-        free(zstream);
     }
     else
     {
         // skip header
-        data += 4;
+        data = (byte *)W_CacheLumpNum(lump) + 4;
     }
 
     // Read extra vertexes added during node building
@@ -3132,6 +3160,196 @@ static nodeformat_t P_CheckNodeFormat(int lumpnum)
     return format;
 }
 
+//
+// P_PrefetchLevel
+// Warms the lump cache for the next map while the intermission is showing,
+// so that P_SetupLevel() finds its lumps, nodes and graphics already in
+// memory, and its music already converted. The work is spread across tics
+// by P_PrefetchTicker().
+//
+#define PREFETCHLUMPSPERTIC 16
+
+void P_CancelPrefetch(void)
+{
+    free(prefetchlumps);
+    prefetchlumps = NULL;
+    numprefetchlumps = 0;
+
+    free(prefetchznodes);
+    prefetchznodes = NULL;
+    prefetchznodeslump = -1;
+
+    prefetchlumpnum = -1;
+}
+
+void P_PrefetchLevel(int ep, int map)
+{
+    char    lumpname[6];
+    int     b;
+
+    P_CancelPrefetch();
+
+    if (gamemode == commercial)
+        M_snprintf(lumpname, sizeof(lumpname), "MAP%02i", map);
+    else
+        M_snprintf(lumpname, sizeof(lumpname), "E%iM%i", ep, map);
+
+    if (W_CheckNumForName(lumpname) < 0)
+        return;
+
+    prefetchlumpnum = (nerve && gamemission == doom2 ? W_GetLastNumForName(lumpname) : W_GetNumForName(lumpname));
+    prefetchepisode = ep;
+    prefetchmap = map;
+    prefetchstep = ML_THINGS;
+
+    // leave hexen format maps for P_SetupLevel() to reject
+    if ((b = prefetchlumpnum + ML_BLOCKMAP + 1) < numlumps && !strncasecmp(lumpinfo[b]->name, "BEHAVIOR", 8))
+        prefetchlumpnum = -1;
+}
+
+static int P_PrefetchFlatNum(const char *name)
+{
+    const int   i = W_CheckNumForName(name);
+
+    return (i >= firstflat && i < firstflat + numflats ? i - firstflat : R_CheckFlatNumForName(name));
+}
+
+// Gather the flats and wall patches used by the map's sectors and sidedefs
+static void P_PrefetchGraphics(void)
+{
+    const int   sectorslump = prefetchlumpnum + ML_SECTORS;
+    const int   sideslump = prefetchlumpnum + ML_SIDEDEFS;
+    bool        *hitlist = calloc(MAX(numtextures, numflats), sizeof(bool));
+    int         maxlumps = 0;
+
+    if (sectorslump < numlumps)
+    {
+        const mapsector_t   *ms = W_CacheLumpNum(sectorslump);
+        const int           count = W_LumpLength(sectorslump) / sizeof(mapsector_t);
+
+        for (int i = 0; i < count; i++)
+        {
+            int flat;
+
+            if ((flat = P_PrefetchFlatNum(ms[i].floorpic)) >= 0)
+                hitlist[flat] = true;
+
+            if ((flat = P_PrefetchFlatNum(ms[i].ceilingpic)) >= 0)
+                hitlist[flat] = true;
+        }
+
+        for (int i = 0; i < numflats; i++)
+            if (hitlist[i])
+            {
+                if (numprefetchlumps == maxlumps)
+                    prefetchlumps = I_Realloc(prefetchlumps, (maxlumps = MAX(maxlumps * 2, 256)) * sizeof(*prefetchlumps));
+
+                prefetchlumps[numprefetchlumps++] = firstflat + i;
+            }
+
+        W_ReleaseLumpNum(sectorslump);
+    }
+
+    if (sideslump < numlumps)
+    {
+        const mapsidedef_t  *msd = W_CacheLumpNum(sideslump);
+        const int           count = W_LumpLength(sideslump) / sizeof(mapsidedef_t);
+
+        memset(hitlist, false, MAX(numtextures, numflats) * sizeof(*hitlist));
+
+        for (int i = 0; i < count; i++)
+        {
+            int texture;
+
+            if ((texture = R_CheckTextureNumForName(msd[i].toptexture)) > 0)
+                hitlist[texture] = true;
+
+            if ((texture = R_CheckTextureNumForName(msd[i].midtexture)) > 0)
+                hitlist[texture] = true;
+
+            if ((texture = R_CheckTextureNumForName(msd[i].bottomtexture)) > 0)
+                hitlist[texture] = true;
+        }
+
+        for (int i = 0; i < numtextures; i++)
+            if (hitlist[i])
+            {
+                const texture_t *texture = textures[i];
+
+                for (int j = 0; j < texture->patchcount; j++)
+                {
+                    if (numprefetchlumps == maxlumps)
+                        prefetchlumps = I_Realloc(prefetchlumps, (maxlumps = MAX(maxlumps * 2, 256)) * sizeof(*prefetchlumps));
+
+                    prefetchlumps[numprefetchlumps++] = texture->patches[j].patch;
+                }
+            }
+
+        W_ReleaseLumpNum(sideslump);
+    }
+
+    free(hitlist);
+}
+
+void P_PrefetchTicker(void)
+{
+    if (prefetchlumpnum < 0)
+        return;
+
+    // read in one map lump per tic
+    if (prefetchstep <= ML_BLOCKMAP)
+    {
+        const int   lump = prefetchlumpnum + prefetchstep++;
+
+        if (lump < numlumps)
+        {
+            W_CacheLumpNum(lump);
+            W_ReleaseLumpNum(lump);
+        }
+
+        return;
+    }
+
+    // then inflate compressed nodes and gather the graphics to read
+    if (prefetchstep == ML_BLOCKMAP + 1)
+    {
+        prefetchstep++;
+
+        if (P_CheckNodeFormat(prefetchlumpnum) == ZDBSPZ)
+        {
+            prefetchznodeslump = prefetchlumpnum + ML_NODES;
+            prefetchznodes = P_InflateZNodes(prefetchznodeslump);
+        }
+
+        P_PrefetchGraphics();
+        return;
+    }
+
+    // then convert the map's music
+    if (prefetchstep == ML_BLOCKMAP + 2)
+    {
+        prefetchstep++;
+        S_PrecacheMusic(prefetchepisode, prefetchmap);
+        return;
+    }
+
+    // then read in a few graphics lumps per tic
+    for (int i = 0; i < PREFETCHLUMPSPERTIC && numprefetchlumps; i++)
+    {
+        const int   lump = prefetchlumps[--numprefetchlumps];
+
+        W_CacheLumpNum(lump);
+        W_ReleaseLumpNum(lump);
+    }
+
+    if (!numprefetchlumps)
+    {
+        free(prefetchlumps);
+        prefetchlumps = NULL;
+        prefetchlumpnum = -1;
+    }
+}
+
 //
 // P_SetupLevel
 //
@@ -3160,6 +3378,7 @@ void P_SetupLevel(int ep, int map)
     idclevtics = 0;
 
     Z_FreeTags(PU_LEVEL, PU_PURGELEVEL - 1);
+    P_ClearMobjs();
 
     if (rejectlump != -1)
     {
@@ -3169,6 +3388,7 @@ void P_SetupLevel(int ep, int map)
     }
 
     P_InitThinkers();
+    R_ClearMovingSectors();
 
     secretmap = false;
 
@@ -3313,8 +3533,11 @@ void P_SetupLevel(int ep, int map)
         P_LoadSegs(lumpnum + ML_SEGS);
     }
 
+    P_CancelPrefetch();
+
     P_GroupLines();
     P_LoadReject(lumpnum);
+    P_InitSoundGraph();
 
     P_RemoveSlimeTrails();
 
@@ -3471,6 +3694,7 @@ static bool P_ParseMapInfo(const char *scriptname)
     mapinfo_t   *info;
     char        *temp1;
     char        *temp2;
+    uint64_t    starttime;
 
     for (MAPINFO = numlumps - 1; MAPINFO >= 0; MAPINFO--)
         if (!strncasecmp(lumpinfo[MAPINFO]->name, scriptname, 8))
@@ -3486,6 +3710,7 @@ static bool P_ParseMapInfo(const char *scriptname)
 
     mapinfolump = uppercase(scriptname);
 
+    starttime = I_GetTimeUS();
     SC_Open(MAPINFO);
 
     while (SC_GetString())
@@ -4185,9 +4410,9 @@ static bool P_ParseMapInfo(const char *scriptname)
 
     temp1 = commify(sc_Line);
     temp2 = uppercase(scriptname);
-    C_Output("%s line%s have been parsed in the " BOLD("%s") " lump in the %s " BOLD("%s") ".",
+    C_Output("%s line%s have been parsed in the " BOLD("%s") " lump in the %s " BOLD("%s") " in %.2f milliseconds.",
         temp1, (sc_Line == 1 ? "" : "s"), temp2, (lumpinfo[MAPINFO]->wadfile->type == IWAD ? "IWAD" : "PWAD"),
-        lumpinfo[MAPINFO]->wadfile->path);
+        lumpinfo[MAPINFO]->wadfile->path, (I_GetTimeUS() - starttime) / 1000.0);
     free(temp1);
     free(temp2);
 
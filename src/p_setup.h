@@ -67,6 +67,9 @@ extern char         mapnumandtitle[512];
 extern char         automaptitle[512];
 
 void P_SetupLevel(int ep, int map);
+void P_PrefetchLevel(int ep, int map);
+void P_PrefetchTicker(void);
+void P_CancelPrefetch(void);
 void P_MapName(int ep, int map);
 
 // Called by startup code.
@@ -2806,6 +2806,7 @@ void T_Scroll(scroll_t *scroller)
                 side->oldtextureoffset = side->basetextureoffset;
                 side->oldrowoffset = side->baserowoffset;
                 side->oldgametime = gametime;
+                R_AddScrollingSide(side);
             }
 
             side->basetextureoffset += dx;
@@ -2824,6 +2825,7 @@ void T_Scroll(scroll_t *scroller)
                 sec->oldfloorxoffset = sec->basefloorxoffset;
                 sec->oldflooryoffset = sec->baseflooryoffset;
                 sec->oldflooroffsetgametime = gametime;
+                R_AddMovingSector(sec);
             }
 
             sec->basefloorxoffset += dx;
@@ -2842,6 +2844,7 @@ void T_Scroll(scroll_t *scroller)
                 sec->oldceilingxoffset = sec->baseceilingxoffset;
                 sec->oldceilingyoffset = sec->baseceilingyoffset;
                 sec->oldceilingoffsetgametime = gametime;
+                R_AddMovingSector(sec);
             }
 
             sec->baseceilingxoffset += dx;
@@ -48,7 +48,8 @@ int         totaltime;
 //
 // THINKERS
 // All thinkers should be allocated by Z_Malloc
-// so they can be operated on uniformly.
+// so they can be operated on uniformly, except
+// map objects, which come from P_AllocMobj().
 // The actual structures will vary in size,
 // but the first element must be thinker_t.
 //
@@ -140,7 +141,9 @@ void P_RemoveThinkerDelayed(thinker_t *thinker)
 
         // Remove from current thinker class list
         (th->cprev = currentthinker = thinker->cprev)->cnext = th;
-        Z_Free(thinker);
+
+        // only map objects are removed this way, so return it to the mobj pool
+        P_FreeMobj((mobj_t *)thinker);
     }
 }
 
@@ -34,6 +34,7 @@
 */
 
 #include "doomstat.h"
+#include "i_system.h"
 #include "m_bbox.h"
 #include "m_config.h"
 #include "r_plane.h"
@@ -174,85 +175,139 @@ static void R_RecalcLineFlags(line_t *line)
     }
 }
 
-// [AM] Interpolate the passed sector.
-static void R_InterpolateSector(sector_t *sector)
+//
+// [AM] Sector and sidedef interpolation
+// Only sectors moved or scrolled and sidedefs scrolled by a thinker are
+//  interpolated, once per frame, rather than every time the BSP traversal
+//  reaches them. They are added by T_MovePlane() and T_Scroll(), and are
+//  dropped again once they haven't moved for a whole tic.
+//
+static sector_t **movingsectors;
+static int      nummovingsectors;
+static int      maxmovingsectors;
+
+static side_t   **scrollingsides;
+static int      numscrollingsides;
+static int      maxscrollingsides;
+
+void R_AddMovingSector(sector_t *sector)
 {
-    sector_t    *heightsec = sector->heightsec;
+    if (sector->ismoving)
+        return;
 
-    if (vid_capfps != TICRATE)
-    {
-        if (sector->floordata
-            && sector->floorheight != sector->oldfloorheight
-            && sector->oldfloorgametime == gametime - 1)
-            sector->interpfloorheight = sector->oldfloorheight
-                + FixedMul(sector->floorheight - sector->oldfloorheight, fractionaltic);
-        else
-            sector->interpfloorheight = sector->floorheight;
+    if (nummovingsectors == maxmovingsectors)
+        movingsectors = I_Realloc(movingsectors, (maxmovingsectors = MAX(64, maxmovingsectors * 2)) * sizeof(*movingsectors));
 
-        if (sector->ceilingdata
-            && sector->ceilingheight != sector->oldceilingheight
-            && sector->oldceilinggametime == gametime - 1)
-            sector->interpceilingheight = sector->oldceilingheight
-                + FixedMul(sector->ceilingheight - sector->oldceilingheight, fractionaltic);
-        else
-            sector->interpceilingheight = sector->ceilingheight;
+    movingsectors[nummovingsectors++] = sector;
+    sector->ismoving = true;
+}
 
-        if (heightsec)
-        {
-            if (heightsec->floordata
-                && heightsec->floorheight != heightsec->oldfloorheight
-                && heightsec->oldfloorgametime == gametime - 1)
-                heightsec->interpfloorheight = heightsec->oldfloorheight
-                    + FixedMul(heightsec->floorheight - heightsec->oldfloorheight, fractionaltic);
-            else
-                heightsec->interpfloorheight = heightsec->floorheight;
+void R_AddScrollingSide(side_t *side)
+{
+    if (side->isscrolling)
+        return;
 
-            if (heightsec->ceilingdata
-                && heightsec->ceilingheight != heightsec->oldceilingheight
-                && heightsec->oldceilinggametime == gametime - 1)
-                heightsec->interpceilingheight = heightsec->oldceilingheight
-                    + FixedMul(heightsec->ceilingheight - heightsec->oldceilingheight, fractionaltic);
-            else
-                heightsec->interpceilingheight = heightsec->ceilingheight;
-        }
+    if (numscrollingsides == maxscrollingsides)
+        scrollingsides = I_Realloc(scrollingsides, (maxscrollingsides = MAX(64, maxscrollingsides * 2)) * sizeof(*scrollingsides));
 
-        if (sector->oldflooroffsetgametime == gametime - 1)
-        {
-            sector->floorxoffset = sector->oldfloorxoffset +
-                FixedMul(sector->basefloorxoffset - sector->oldfloorxoffset, fractionaltic);
-            sector->flooryoffset = sector->oldflooryoffset +
-                FixedMul(sector->baseflooryoffset - sector->oldflooryoffset, fractionaltic);
-        }
+    scrollingsides[numscrollingsides++] = side;
+    side->isscrolling = true;
+}
 
-        if (sector->oldceilingoffsetgametime == gametime - 1)
-        {
-            sector->ceilingxoffset = sector->oldceilingxoffset +
-                FixedMul(sector->baseceilingxoffset - sector->oldceilingxoffset, fractionaltic);
-            sector->ceilingyoffset = sector->oldceilingyoffset +
-                FixedMul(sector->baseceilingyoffset - sector->oldceilingyoffset, fractionaltic);
-        }
-    }
+//
+// R_ClearMovingSectors
+// Called when a new map is loaded, so the sectors and sidedefs of the previous
+//  map are forgotten without being touched.
+//
+void R_ClearMovingSectors(void)
+{
+    nummovingsectors = 0;
+    numscrollingsides = 0;
+}
+
+static void R_InterpolateSector(sector_t *sector, const bool interpolate, const int lastgametime)
+{
+    if (interpolate
+        && sector->floordata
+        && sector->floorheight != sector->oldfloorheight
+        && sector->oldfloorgametime == lastgametime)
+        sector->interpfloorheight = sector->oldfloorheight
+            + FixedMul(sector->floorheight - sector->oldfloorheight, fractionaltic);
     else
-    {
         sector->interpfloorheight = sector->floorheight;
+
+    if (interpolate
+        && sector->ceilingdata
+        && sector->ceilingheight != sector->oldceilingheight
+        && sector->oldceilinggametime == lastgametime)
+        sector->interpceilingheight = sector->oldceilingheight
+            + FixedMul(sector->ceilingheight - sector->oldceilingheight, fractionaltic);
+    else
         sector->interpceilingheight = sector->ceilingheight;
 
-        if (heightsec)
-        {
-            heightsec->interpfloorheight = heightsec->floorheight;
-            heightsec->interpceilingheight = heightsec->ceilingheight;
-        }
+    if (interpolate && sector->oldflooroffsetgametime == lastgametime)
+    {
+        sector->floorxoffset = sector->oldfloorxoffset +
+            FixedMul(sector->basefloorxoffset - sector->oldfloorxoffset, fractionaltic);
+        sector->flooryoffset = sector->oldflooryoffset +
+            FixedMul(sector->baseflooryoffset - sector->oldflooryoffset, fractionaltic);
+    }
+
+    if (interpolate && sector->oldceilingoffsetgametime == lastgametime)
+    {
+        sector->ceilingxoffset = sector->oldceilingxoffset +
+            FixedMul(sector->baseceilingxoffset - sector->oldceilingxoffset, fractionaltic);
+        sector->ceilingyoffset = sector->oldceilingyoffset +
+            FixedMul(sector->baseceilingyoffset - sector->oldceilingyoffset, fractionaltic);
     }
 }
 
-static void R_InterpolateTextureOffsets(side_t *side)
+//
+// R_InterpolateMovingSectors
+// Called once per frame, before the BSP traversal.
+//
+void R_InterpolateMovingSectors(void)
 {
-    if (vid_capfps != TICRATE && side->oldgametime == gametime - 1)
+    const bool  interpolate = (vid_capfps != TICRATE);
+    const int   lastgametime = gametime - 1;
+
+    for (int i = 0; i < nummovingsectors; )
+    {
+        sector_t    *sector = movingsectors[i];
+
+        R_InterpolateSector(sector, interpolate, lastgametime);
+
+        if (sector->oldfloorgametime < lastgametime
+            && sector->oldceilinggametime < lastgametime
+            && sector->oldflooroffsetgametime < lastgametime
+            && sector->oldceilingoffsetgametime < lastgametime)
+        {
+            sector->ismoving = false;
+            movingsectors[i] = movingsectors[--nummovingsectors];
+        }
+        else
+            i++;
+    }
+
+    for (int i = 0; i < numscrollingsides; )
     {
-        side->textureoffset = side->oldtextureoffset
-            + FixedMul(side->basetextureoffset - side->oldtextureoffset, fractionaltic);
-        side->rowoffset = side->oldrowoffset
-            + FixedMul(side->baserowoffset - side->oldrowoffset, fractionaltic);
+        side_t  *side = scrollingsides[i];
+
+        if (interpolate && side->oldgametime == lastgametime)
+        {
+            side->textureoffset = side->oldtextureoffset
+                + FixedMul(side->basetextureoffset - side->oldtextureoffset, fractionaltic);
+            side->rowoffset = side->oldrowoffset
+                + FixedMul(side->baserowoffset - side->oldrowoffset, fractionaltic);
+        }
+
+        if (side->oldgametime < lastgametime)
+        {
+            side->isscrolling = false;
+            scrollingsides[i] = scrollingsides[--numscrollingsides];
+        }
+        else
+            i++;
     }
 }
 
@@ -415,17 +470,11 @@ static void R_AddLine(seg_t *line)
     if (x1 >= x2)
         return;
 
-    R_InterpolateTextureOffsets(line->sidedef);
-
     // Single sided line?
     if ((backsector = line->backsector))
     {
         sector_t    tempsec;    // killough 03/08/98: ceiling/water hack
 
-        // [AM] Interpolate sector movement before running clipping tests.
-        // Frontsector should already be interpolated.
-        R_InterpolateSector(backsector);
-
         // killough 03/08/98, 04/04/98: hack for invisible ceilings/deep water
         backsector = R_FakeFlat(backsector, &tempsec, NULL, NULL, true);
     }
@@ -536,9 +585,6 @@ static void R_Subsector(int num)
     int         count = sub->numlines;
     seg_t       *line = segs + sub->firstline;
 
-    // [AM] Interpolate sector movement. Usually only needed when player is standing inside the sector.
-    R_InterpolateSector(sector);
-
     // killough 03/08/98, 04/04/98: Deep water/fake ceiling effect
     frontsector = R_FakeFlat(sector, &tempsec, &floorlightlevel, &ceilinglightlevel, false);
 
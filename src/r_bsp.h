@@ -53,6 +53,11 @@ void R_ClearDrawSegs(void);
 
 void R_RenderBSPNode(int bspnum);
 
+void R_AddMovingSector(sector_t *sector);
+void R_AddScrollingSide(side_t *side);
+void R_ClearMovingSectors(void);
+void R_InterpolateMovingSectors(void);
+
 // killough 04/13/98: fake floors/ceilings for deep water/fake ceilings:
 sector_t *R_FakeFlat(sector_t *sec, sector_t *tempsec,
     int *floorlightlevel, int *ceilinglightlevel, const bool back);
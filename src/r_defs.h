@@ -210,6 +210,9 @@ typedef struct sector_s
 
     bool                islift;
     bool                isselfreferencing;
+
+    // in the list of sectors interpolated each frame
+    bool                ismoving;
 } sector_t;
 
 //
@@ -246,6 +249,9 @@ typedef struct
     fixed_t             basetextureoffset;
     fixed_t             baserowoffset;
     int                 oldgametime;
+
+    // in the list of sidedefs interpolated each frame
+    bool                isscrolling;
 } side_t;
 
 //
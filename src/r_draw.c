@@ -61,6 +61,13 @@ int             fuzz2table[MAXSCREENAREA];
 
 static byte     *ylookup0[MAXHEIGHT];
 static byte     *ylookup1[MAXHEIGHT];
+static int      columnofs[MAXWIDTH];
+static int      columnpitch;
+static int      spanpitch;
+
+// when r_columnmajor is on, walls, floors, ceilings and skies are drawn into
+// this buffer one column after another, and then transposed into screens[0]
+static byte     columnmajorbuffer[MAXSCREENAREA];
 
 lighttable_t    *dc_colormap[2];
 lighttable_t    *dc_nextcolormap[2];
@@ -78,964 +85,432 @@ byte            *dc_brightmap;
 int             dc_floorclip;
 int             dc_ceilingclip;
 int             dc_numposts;
-byte            dc_black;
-byte            *dc_black33;
-byte            *dc_black40;
-byte            *dc_source;
-byte            *dc_translation;
-
-#define DITHERSIZE  4
-
-static const byte ditherlowmatrix[DITHERSIZE * 2][DITHERSIZE * 2] =
-{
-    {   0,   0, 224, 224,  48,  48, 208, 208 },
-    {   0,   0, 224, 224,  48,  48, 208, 208 },
-    { 176, 176,  80,  80, 128, 128,  96,  96 },
-    { 176, 176,  80,  80, 128, 128,  96,  96 },
-    { 192, 192,  32,  32, 240, 240,  16,  16 },
-    { 192, 192,  32,  32, 240, 240,  16,  16 },
-    { 112, 112, 144, 144,  64,  64, 160, 160 },
-    { 112, 112, 144, 144,  64,  64, 160, 160 }
-};
-
-#define ditherlow(x, y, z)  (ditherlowmatrix[((y) & (DITHERSIZE * 2 - 1))][((x) & (DITHERSIZE * 2 - 1))] < (z))
-
-static const byte dithermatrix[DITHERSIZE][DITHERSIZE] =
-{
-    {   0, 224,  48, 208 },
-    { 176,  80, 128,  96 },
-    { 192,  32, 240,  16 },
-    { 112, 144,  64, 160 }
-};
-
-#define dither(x, y, z)     (dithermatrix[((y) & (DITHERSIZE - 1))][((x) & (DITHERSIZE - 1))] < (z))
-
-//
-// A column is a vertical slice/span from a wall texture that,
-//  given the DOOM style restrictions on the view orientation,
-//  will always have constant z-depth.
-// Thus a special case loop for very fast rendering can
-//  be used. It has also been used with Wolfenstein 3D.
-//
-
-void R_DrawColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap = dc_colormap[0];
-
-    while (--count)
-    {
-        *dest = colormap[dc_source[frac >> FRACBITS]];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
-
-    *dest = colormap[dc_source[frac >> FRACBITS]];
-}
-
-void R_DrawBrightmapColumn(void)
-{
-    int     count = dc_yh - dc_yl + 1;
-    byte    *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t frac = dc_texturefrac;
-    byte    dot;
-
-    while (--count)
-    {
-        dot = dc_source[frac >> FRACBITS];
-        *dest = dc_colormap[dc_brightmap[dot]][dot];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
-
-    dot = dc_source[frac >> FRACBITS];
-    *dest = dc_colormap[dc_brightmap[dot]][dot];
-}
-
-void R_DrawDitherLowColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap[2] = { dc_colormap[0], dc_nextcolormap[0] };
-
-    while (--count)
-    {
-        *dest = colormap[ditherlow(dc_x, dc_yl++, dc_z)][dc_source[frac >> FRACBITS]];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
-
-    *dest = colormap[ditherlow(dc_x, dc_yl, dc_z)][dc_source[frac >> FRACBITS]];
-}
-
-void R_DrawDitherColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap[2] = { dc_colormap[0], dc_nextcolormap[0] };
-
-    while (--count)
-    {
-        *dest = colormap[dither(dc_x, dc_yl++, dc_z)][dc_source[frac >> FRACBITS]];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
-
-    *dest = colormap[dither(dc_x, dc_yl, dc_z)][dc_source[frac >> FRACBITS]];
-}
-
-void R_DrawBrightmapDitherLowColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap[2][2] = { { dc_colormap[0], dc_nextcolormap[0] }, { fullcolormap, fullcolormap } };
-    byte                dot;
-
-    while (--count)
-    {
-        dot = dc_source[frac >> FRACBITS];
-        *dest = colormap[dc_brightmap[dot]][ditherlow(dc_x, dc_yl++, dc_z)][dot];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
-
-    dot = dc_source[frac >> FRACBITS];
-    *dest = colormap[dc_brightmap[dot]][ditherlow(dc_x, dc_yl++, dc_z)][dot];
-}
-
-void R_DrawBrightmapDitherColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap[2][2] = { { dc_colormap[0], dc_nextcolormap[0] }, { fullcolormap, fullcolormap } };
-    byte                dot;
-
-    while (--count)
-    {
-        dot = dc_source[frac >> FRACBITS];
-        *dest = colormap[dc_brightmap[dot]][dither(dc_x, dc_yl++, dc_z)][dot];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
-
-    dot = dc_source[frac >> FRACBITS];
-    *dest = colormap[dc_brightmap[dot]][dither(dc_x, dc_yl++, dc_z)][dot];
-}
-
-void R_DrawCorrectedColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap = dc_colormap[0];
-
-    while (--count)
-    {
-        *dest = colormap[nearestcolors[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
-
-    *dest = colormap[nearestcolors[dc_source[frac >> FRACBITS]]];
-}
-
-void R_DrawCorrectedDitherLowColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap[2] = { dc_colormap[0], dc_nextcolormap[0] };
-
-    while (--count)
-    {
-        *dest = colormap[ditherlow(dc_x, dc_yl++, dc_z)][nearestcolors[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
-
-    *dest = colormap[ditherlow(dc_x, dc_yl, dc_z)][nearestcolors[dc_source[frac >> FRACBITS]]];
-}
-
-void R_DrawCorrectedDitherColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap[2] = { dc_colormap[0], dc_nextcolormap[0] };
-
-    while (--count)
-    {
-        *dest = colormap[dither(dc_x, dc_yl++, dc_z)][nearestcolors[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
-
-    *dest = colormap[dither(dc_x, dc_yl, dc_z)][nearestcolors[dc_source[frac >> FRACBITS]]];
-}
-
-void R_DrawColorColumn(void)
-{
-    int         count = dc_yh - dc_yl + 1;
-    byte        *dest = ylookup0[dc_yl] + dc_x;
-    const byte  color = dc_colormap[0][NOTEXTURECOLOR];
-
-    while (--count)
-    {
-        *dest = color;
-        dest += SCREENWIDTH;
-    }
-
-    *dest = color;
-}
-
-void R_DrawColorDitherLowColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    const lighttable_t  *colormap[2] = { dc_colormap[0], dc_nextcolormap[0] };
-
-    while (--count)
-    {
-        *dest = colormap[ditherlow(dc_x, dc_yl++, dc_z)][NOTEXTURECOLOR];
-        dest += SCREENWIDTH;
-    }
-
-    *dest = colormap[ditherlow(dc_x, dc_yl, dc_z)][NOTEXTURECOLOR];
-}
-
-void R_DrawColorDitherColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    const lighttable_t  *colormap[2] = { dc_colormap[0], dc_nextcolormap[0] };
-
-    while (--count)
-    {
-        *dest = colormap[dither(dc_x, dc_yl++, dc_z)][NOTEXTURECOLOR];
-        dest += SCREENWIDTH;
-    }
-
-    *dest = colormap[dither(dc_x, dc_yl, dc_z)][NOTEXTURECOLOR];
-}
-
-void R_DrawShadowColumn(void)
-{
-    int     count = dc_yh - dc_yl;
-    byte    *dest = ylookup0[dc_yl] + dc_x;
-
-    if (count)
-    {
-        *dest = *(*dest + dc_black33);
-        dest += SCREENWIDTH;
-
-        while (--count)
-        {
-            *dest = *(*dest + dc_black40);
-            dest += SCREENWIDTH;
-        }
-
-        *dest = *(*dest + (dc_yh == dc_floorclip ? dc_black40 : dc_black33));
-    }
-    else
-        *dest = *(*dest + dc_black33);
-}
-
-void R_DrawFuzzyShadowColumn(void)
-{
-    byte    *dest;
-    int     count;
-
-    if (dc_x & 1)
-        return;
-
-    dest = ylookup0[dc_yl] + dc_x;
-
-    if ((count = dc_yh - dc_yl))
-    {
-        *dest = *(*dest + dc_black33);
-        *(dest + 1) = *(*(dest + 1) + dc_black33);
-        dest += SCREENWIDTH;
-
-        while (--count)
-        {
-            *dest = *(*dest + dc_black33);
-            *(dest + 1) = *(*(dest + 1) + dc_black33);
-            dest += SCREENWIDTH;
-        }
-
-        *dest = *(*dest + dc_black33);
-        *(dest + 1) = *(*(dest + 1) + dc_black33);
-    }
-    else
-    {
-        *dest = *(*dest + dc_black33);
-        *(dest + 1) = *(*(dest + 1) + dc_black33);
-    }
-}
-
-void R_DrawSolidShadowColumn(void)
-{
-    int     count = dc_yh - dc_yl + 1;
-    byte    *dest = ylookup0[dc_yl] + dc_x;
-
-    while (--count)
-    {
-        *dest = dc_black;
-        dest += SCREENWIDTH;
-    }
-
-    *dest = dc_black;
-}
-
-void R_DrawBloodSplatColumn(void)
-{
-    int     count = dc_yh - dc_yl + 1;
-    byte    *dest = ylookup0[dc_yl] + dc_x;
-
-    while (--count)
-    {
-        *dest = *(*dest + dc_bloodcolor);
-        dest += SCREENWIDTH;
-    }
-
-    *dest = *(*dest + dc_bloodcolor);
-}
-
-void R_DrawSolidBloodSplatColumn(void)
-{
-    int     count = dc_yh - dc_yl + 1;
-    byte    *dest = ylookup0[dc_yl] + dc_x;
-
-    while (--count)
-    {
-        *dest = dc_solidbloodcolor;
-        dest += SCREENWIDTH;
-    }
-
-    *dest = dc_solidbloodcolor;
-}
-
-void R_DrawWallColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturemid + (dc_yl - centery) * dc_iscale;
-    const lighttable_t  *colormap = dc_colormap[0];
-    fixed_t             heightmask = dc_texheight - 1;
-
-    if (dc_texheight & heightmask)
-    {
-        heightmask = (heightmask + 1) << FRACBITS;
-
-        if (frac < 0)
-            while ((frac += heightmask) < 0);
-        else
-            while (frac >= heightmask)
-                frac -= heightmask;
-
-        while (--count)
-        {
-            *dest = colormap[dc_source[frac >> FRACBITS]];
-            dest += SCREENWIDTH;
-
-            if ((frac += dc_iscale) >= heightmask)
-                frac -= heightmask;
-        }
-
-        *dest = colormap[dc_source[frac >> FRACBITS]];
-    }
-    else
-    {
-        while (--count)
-        {
-            *dest = colormap[dc_source[((frac >> FRACBITS) & heightmask)]];
-            dest += SCREENWIDTH;
-            frac += dc_iscale;
-        }
-
-        *dest = colormap[dc_source[((frac >> FRACBITS) & heightmask)]];
-    }
-}
-
-void R_DrawDitherLowWallColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturemid + (dc_yl - centery) * dc_iscale;
-    const lighttable_t  *colormap[2] = { dc_colormap[0], dc_nextcolormap[0] };
-    fixed_t             heightmask = dc_texheight - 1;
-
-    if (dc_texheight & heightmask)
-    {
-        heightmask = (heightmask + 1) << FRACBITS;
-
-        if (frac < 0)
-            while ((frac += heightmask) < 0);
-        else
-            while (frac >= heightmask)
-                frac -= heightmask;
-
-        while (--count)
-        {
-            *dest = colormap[ditherlow(dc_x, dc_yl++, dc_z)][dc_source[frac >> FRACBITS]];
-            dest += SCREENWIDTH;
-
-            if ((frac += dc_iscale) >= heightmask)
-                frac -= heightmask;
-        }
-
-        *dest = colormap[ditherlow(dc_x, dc_yl, dc_z)][dc_source[frac >> FRACBITS]];
-    }
-    else
-    {
-        while (--count)
-        {
-            *dest = colormap[ditherlow(dc_x, dc_yl++, dc_z)][dc_source[((frac >> FRACBITS) & heightmask)]];
-            dest += SCREENWIDTH;
-            frac += dc_iscale;
-        }
-
-        *dest = colormap[ditherlow(dc_x, dc_yl, dc_z)][dc_source[((frac >> FRACBITS) & heightmask)]];
-    }
-}
-
-void R_DrawDitherWallColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturemid + (dc_yl - centery) * dc_iscale;
-    const lighttable_t  *colormap[2] = { dc_colormap[0], dc_nextcolormap[0] };
-    fixed_t             heightmask = dc_texheight - 1;
-
-    if (dc_texheight & heightmask)
-    {
-        heightmask = (heightmask + 1) << FRACBITS;
-
-        if (frac < 0)
-            while ((frac += heightmask) < 0);
-        else
-            while (frac >= heightmask)
-                frac -= heightmask;
-
-        while (--count)
-        {
-            *dest = colormap[dither(dc_x, dc_yl++, dc_z)][dc_source[frac >> FRACBITS]];
-            dest += SCREENWIDTH;
-
-            if ((frac += dc_iscale) >= heightmask)
-                frac -= heightmask;
-        }
-
-        *dest = colormap[dither(dc_x, dc_yl, dc_z)][dc_source[frac >> FRACBITS]];
-    }
-    else
-    {
-        while (--count)
-        {
-            *dest = colormap[dither(dc_x, dc_yl++, dc_z)][dc_source[((frac >> FRACBITS) & heightmask)]];
-            dest += SCREENWIDTH;
-            frac += dc_iscale;
-        }
-
-        *dest = colormap[dither(dc_x, dc_yl, dc_z)][dc_source[((frac >> FRACBITS) & heightmask)]];
-    }
-}
-
-void R_DrawBrightmapWallColumn(void)
-{
-    int     count = dc_yh - dc_yl + 1;
-    byte    *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t frac = dc_texturemid + (dc_yl - centery) * dc_iscale;
-    fixed_t heightmask = dc_texheight - 1;
-    byte    dot;
-
-    if (dc_texheight & heightmask)
-    {
-        heightmask = (heightmask + 1) << FRACBITS;
-
-        if (frac < 0)
-            while ((frac += heightmask) < 0);
-        else
-            while (frac >= heightmask)
-                frac -= heightmask;
-
-        while (--count)
-        {
-            dot = dc_source[frac >> FRACBITS];
-            *dest = dc_colormap[dc_brightmap[dot]][dot];
-            dest += SCREENWIDTH;
-
-            if ((frac += dc_iscale) >= heightmask)
-                frac -= heightmask;
-        }
-
-        dot = dc_source[frac >> FRACBITS];
-        *dest = dc_colormap[dc_brightmap[dot]][dot];
-    }
-    else
-    {
-        while (--count)
-        {
-            dot = dc_source[((frac >> FRACBITS) & heightmask)];
-            *dest = dc_colormap[dc_brightmap[dot]][dot];
-            dest += SCREENWIDTH;
-            frac += dc_iscale;
-        }
-
-        dot = dc_source[((frac >> FRACBITS) & heightmask)];
-        *dest = dc_colormap[dc_brightmap[dot]][dot];
-    }
-}
-
-void R_DrawBrightmapDitherLowWallColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturemid + (dc_yl - centery) * dc_iscale;
-    const lighttable_t  *colormap[2][2] = { { dc_colormap[0], dc_nextcolormap[0] }, { fullcolormap, fullcolormap } };
-    fixed_t             heightmask = dc_texheight - 1;
-    byte                dot;
-
-    if (dc_texheight & heightmask)
-    {
-        heightmask = (heightmask + 1) << FRACBITS;
-
-        if (frac < 0)
-            while ((frac += heightmask) < 0);
-        else
-            while (frac >= heightmask)
-                frac -= heightmask;
-
-        while (--count)
-        {
-            dot = dc_source[frac >> FRACBITS];
-            *dest = colormap[dc_brightmap[dot]][ditherlow(dc_x, dc_yl++, dc_z)][dot];
-            dest += SCREENWIDTH;
-
-            if ((frac += dc_iscale) >= heightmask)
-                frac -= heightmask;
-        }
-
-        dot = dc_source[frac >> FRACBITS];
-        *dest = colormap[dc_brightmap[dot]][ditherlow(dc_x, dc_yl, dc_z)][dot];
-    }
-    else
-    {
-        while (--count)
-        {
-            dot = dc_source[((frac >> FRACBITS) & heightmask)];
-            *dest = colormap[dc_brightmap[dot]][ditherlow(dc_x, dc_yl++, dc_z)][dot];
-            dest += SCREENWIDTH;
-            frac += dc_iscale;
-        }
-
-        dot = dc_source[((frac >> FRACBITS) & heightmask)];
-        *dest = colormap[dc_brightmap[dot]][ditherlow(dc_x, dc_yl, dc_z)][dot];
-    }
-}
-
-void R_DrawBrightmapDitherWallColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturemid + (dc_yl - centery) * dc_iscale;
-    const lighttable_t  *colormap[2][2] = { { dc_colormap[0], dc_nextcolormap[0] }, { fullcolormap, fullcolormap } };
-    fixed_t             heightmask = dc_texheight - 1;
-    byte                dot;
-
-    if (dc_texheight & heightmask)
-    {
-        heightmask = (heightmask + 1) << FRACBITS;
-
-        if (frac < 0)
-            while ((frac += heightmask) < 0);
-        else
-            while (frac >= heightmask)
-                frac -= heightmask;
-
-        while (--count)
-        {
-            dot = dc_source[frac >> FRACBITS];
-            *dest = colormap[dc_brightmap[dot]][dither(dc_x, dc_yl++, dc_z)][dot];
-            dest += SCREENWIDTH;
-
-            if ((frac += dc_iscale) >= heightmask)
-                frac -= heightmask;
-        }
-
-        dot = dc_source[frac >> FRACBITS];
-        *dest = colormap[dc_brightmap[dot]][dither(dc_x, dc_yl, dc_z)][dot];
-    }
-    else
-    {
-        while (--count)
-        {
-            dot = dc_source[((frac >> FRACBITS) & heightmask)];
-            *dest = colormap[dc_brightmap[dot]][dither(dc_x, dc_yl++, dc_z)][dot];
-            dest += SCREENWIDTH;
-            frac += dc_iscale;
-        }
-
-        dot = dc_source[((frac >> FRACBITS) & heightmask)];
-        *dest = colormap[dc_brightmap[dot]][dither(dc_x, dc_yl, dc_z)][dot];
-    }
-}
-
-void R_DrawPlayerSpriteColumn(void)
-{
-    int     count = dc_yh - dc_yl + 1;
-    byte    *dest = ylookup1[dc_yl] + dc_x;
-    fixed_t frac = dc_texturefrac;
-
-    while (--count)
-    {
-        *dest = dc_source[frac >> FRACBITS];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
-
-    *dest = dc_source[frac >> FRACBITS];
-}
-
-void R_DrawFlippedSkyColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturemid + (dc_yl - centery) * dc_iscale;
-    const lighttable_t  *colormap = dc_colormap[0];
-    fixed_t             i;
-
-    while (--count)
-    {
-        *dest = colormap[dc_source[((i = frac >> FRACBITS) < 128 ? i : 126 - (i & 127))]];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
-
-    *dest = colormap[dc_source[((i = frac >> FRACBITS) < 128 ? i : 126 - (i & 127))]];
-}
-
-void R_DrawTranslucentBloodColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap = dc_colormap[0];
-
-    while (--count)
-    {
-        *dest = tinttab33[(*dest << 8) + colormap[dc_translation[dc_source[frac >> FRACBITS]]]];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
-
-    *dest = tinttab33[(*dest << 8) + colormap[dc_translation[dc_source[frac >> FRACBITS]]]];
-}
-
-void R_DrawTranslucentColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap = dc_colormap[0];
-
-    while (--count)
-    {
-        *dest = tinttabadditive[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
-
-    *dest = tinttabadditive[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-}
-
-void R_DrawTranslucent50Column(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap = dc_colormap[0];
-
-    while (--count)
-    {
-        *dest = tranmap[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
-
-    *dest = tranmap[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-}
-
-void R_DrawDitherLowTranslucent50Column(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap[2] = { dc_colormap[0], dc_nextcolormap[0] };
-
-    while (--count)
-    {
-        *dest = tranmap[(*dest << 8) + colormap[ditherlow(dc_x, dc_yl++, dc_z)][dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
+byte            dc_black;
+byte            *dc_black33;
+byte            *dc_black40;
+byte            *dc_source;
+byte            *dc_translation;
 
-    *dest = tranmap[(*dest << 8) + colormap[ditherlow(dc_x, dc_yl, dc_z)][dc_source[frac >> FRACBITS]]];
-}
+#define DITHERSIZE  4
 
-void R_DrawDitherTranslucent50Column(void)
+static const byte ditherlowmatrix[DITHERSIZE * 2][DITHERSIZE * 2] =
 {
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap[2] = { dc_colormap[0], dc_nextcolormap[0] };
-
-    while (--count)
-    {
-        *dest = tranmap[(*dest << 8) + colormap[dither(dc_x, dc_yl++, dc_z)][dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
+    {   0,   0, 224, 224,  48,  48, 208, 208 },
+    {   0,   0, 224, 224,  48,  48, 208, 208 },
+    { 176, 176,  80,  80, 128, 128,  96,  96 },
+    { 176, 176,  80,  80, 128, 128,  96,  96 },
+    { 192, 192,  32,  32, 240, 240,  16,  16 },
+    { 192, 192,  32,  32, 240, 240,  16,  16 },
+    { 112, 112, 144, 144,  64,  64, 160, 160 },
+    { 112, 112, 144, 144,  64,  64, 160, 160 }
+};
 
-    *dest = tranmap[(*dest << 8) + colormap[dither(dc_x, dc_yl, dc_z)][dc_source[frac >> FRACBITS]]];
-}
+#define ditherlow(x, y, z)  (ditherlowmatrix[((y) & (DITHERSIZE * 2 - 1))][((x) & (DITHERSIZE * 2 - 1))] < (z))
 
-void R_DrawCorrectedTranslucent50Column(void)
+static const byte dithermatrix[DITHERSIZE][DITHERSIZE] =
 {
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap = dc_colormap[0];
+    {   0, 224,  48, 208 },
+    { 176,  80, 128,  96 },
+    { 192,  32, 240,  16 },
+    { 112, 144,  64, 160 }
+};
 
-    while (--count)
-    {
-        *dest = tranmap[(*dest << 8) + colormap[nearestcolors[dc_source[frac >> FRACBITS]]]];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
+#define dither(x, y, z)     (dithermatrix[((y) & (DITHERSIZE - 1))][((x) & (DITHERSIZE - 1))] < (z))
 
-    *dest = tranmap[(*dest << 8) + colormap[nearestcolors[dc_source[frac >> FRACBITS]]]];
+//
+// Drawer kernels
+// Every column and span drawer below is expanded from one of these kernels,
+//  specialized by lighting mode (FLAT, DITHERLOW, DITHER, or BRIGHTMAP for
+//  each), by how a texel is fetched (TEXEL, CORRECTED or TRANSLATED) and, for
+//  wall columns, by whether the texture's height is a power of 2. Nothing is
+//  decided per pixel other than what the specialization itself needs.
+//
+#define COLORMAP_FLAT                   const lighttable_t  *colormap = dc_colormap[0]
+#define COLORMAP_DITHERLOW              const lighttable_t  *colormap[2] = { dc_colormap[0], dc_nextcolormap[0] }
+#define COLORMAP_DITHER                 COLORMAP_DITHERLOW
+#define COLORMAP_BRIGHTMAP              lighttable_t *const *colormap = dc_colormap
+#define COLORMAP_BRIGHTMAPDITHERLOW     const lighttable_t  *colormap[2][2] = \
+                                            { { dc_colormap[0], dc_nextcolormap[0] }, { fullcolormap, fullcolormap } }
+#define COLORMAP_BRIGHTMAPDITHER        COLORMAP_BRIGHTMAPDITHERLOW
+
+#define LIGHT_FLAT(dot, y)              colormap
+#define LIGHT_DITHERLOW(dot, y)         colormap[ditherlow(dc_x, y, dc_z)]
+#define LIGHT_DITHER(dot, y)            colormap[dither(dc_x, y, dc_z)]
+#define LIGHT_BRIGHTMAP(dot, y)         colormap[dc_brightmap[dot]]
+#define LIGHT_BRIGHTMAPDITHERLOW(dot, y)    colormap[dc_brightmap[dot]][ditherlow(dc_x, y, dc_z)]
+#define LIGHT_BRIGHTMAPDITHER(dot, y)   colormap[dc_brightmap[dot]][dither(dc_x, y, dc_z)]
+
+#define FETCH_TEXEL(dot)                dot
+#define FETCH_CORRECTED(dot)            nearestcolors[dot]
+#define FETCH_TRANSLATED(dot)           dc_translation[dot]
+
+#define COLOR_UNLIT(colormap, nextcolormap)     const byte  color = NOTEXTURECOLOR
+#define COLOR_FLAT(colormap, nextcolormap)      const byte  color = colormap[NOTEXTURECOLOR]
+#define COLOR_DITHERLOW(colormap, nextcolormap) const byte  color[2] = \
+                                                    { colormap[NOTEXTURECOLOR], nextcolormap[NOTEXTURECOLOR] }
+#define COLOR_DITHER(colormap, nextcolormap)    COLOR_DITHERLOW(colormap, nextcolormap)
+
+#define SHADE_UNLIT(x, y, z)            color
+#define SHADE_FLAT(x, y, z)             color
+#define SHADE_DITHERLOW(x, y, z)        color[ditherlow(x, y, z)]
+#define SHADE_DITHER(x, y, z)           color[dither(x, y, z)]
+
+#define SPANCOLORMAP_FLAT               const lighttable_t  *colormap = ds_colormap[0]
+#define SPANCOLORMAP_DITHERLOW          lighttable_t *const *colormap = ds_colormap
+#define SPANCOLORMAP_DITHER             SPANCOLORMAP_DITHERLOW
+
+#define SPANLIGHT_FLAT(x)               colormap
+#define SPANLIGHT_DITHERLOW(x)          colormap[ditherlow(x, ds_y, ds_z)]
+#define SPANLIGHT_DITHER(x)             colormap[dither(x, ds_y, ds_z)]
+
+#define SPANTEXEL                       ds_source[((ds_xfrac >> 16) & 63) | ((ds_yfrac >> 10) & 4032)]
+
+#define DRAWCOLUMN(name, light, fetch)                                                  \
+void name(void)                                                                         \
+{                                                                                       \
+    int     count = dc_yh - dc_yl + 1;                                                  \
+    byte    *dest = ylookup0[dc_yl] + dc_x;                                             \
+    fixed_t frac = dc_texturefrac;                                                      \
+    byte    dot;                                                                        \
+    COLORMAP_##light;                                                                   \
+                                                                                        \
+    while (--count)                                                                     \
+    {                                                                                   \
+        dot = dc_source[frac >> FRACBITS];                                              \
+        *dest = LIGHT_##light(dot, dc_yl++)[FETCH_##fetch(dot)];                        \
+        dest += SCREENWIDTH;                                                            \
+        frac += dc_iscale;                                                              \
+    }                                                                                   \
+                                                                                        \
+    dot = dc_source[frac >> FRACBITS];                                                  \
+    *dest = LIGHT_##light(dot, dc_yl)[FETCH_##fetch(dot)];                              \
+}
+
+#define DRAWTRANSLUCENTCOLUMN(name, light, fetch, tinttab)                              \
+void name(void)                                                                         \
+{                                                                                       \
+    int     count = dc_yh - dc_yl + 1;                                                  \
+    byte    *dest = ylookup0[dc_yl] + dc_x;                                             \
+    fixed_t frac = dc_texturefrac;                                                      \
+    byte    dot;                                                                        \
+    COLORMAP_##light;                                                                   \
+                                                                                        \
+    while (--count)                                                                     \
+    {                                                                                   \
+        dot = dc_source[frac >> FRACBITS];                                              \
+        *dest = tinttab[(*dest << 8) + LIGHT_##light(dot, dc_yl++)[FETCH_##fetch(dot)]]; \
+        dest += SCREENWIDTH;                                                            \
+        frac += dc_iscale;                                                              \
+    }                                                                                   \
+                                                                                        \
+    dot = dc_source[frac >> FRACBITS];                                                  \
+    *dest = tinttab[(*dest << 8) + LIGHT_##light(dot, dc_yl)[FETCH_##fetch(dot)]];      \
+}
+
+#define DRAWWALLCOLUMN(name, light)                                                     \
+static void name##Pow2(void)                                                            \
+{                                                                                       \
+    int             count = dc_yh - dc_yl + 1;                                          \
+    byte            *dest = ylookup0[dc_yl] + columnofs[dc_x];                          \
+    fixed_t         frac = dc_texturemid + (dc_yl - centery) * dc_iscale;               \
+    const fixed_t   heightmask = dc_texheight - 1;                                      \
+    byte            dot;                                                                \
+    COLORMAP_##light;                                                                   \
+                                                                                        \
+    while (--count)                                                                     \
+    {                                                                                   \
+        dot = dc_source[(frac >> FRACBITS) & heightmask];                               \
+        *dest = LIGHT_##light(dot, dc_yl++)[dot];                                       \
+        dest += columnpitch;                                                            \
+        frac += dc_iscale;                                                              \
+    }                                                                                   \
+                                                                                        \
+    dot = dc_source[(frac >> FRACBITS) & heightmask];                                   \
+    *dest = LIGHT_##light(dot, dc_yl)[dot];                                             \
+}                                                                                       \
+                                                                                        \
+static void name##NonPow2(void)                                                         \
+{                                                                                       \
+    int             count = dc_yh - dc_yl + 1;                                          \
+    byte            *dest = ylookup0[dc_yl] + columnofs[dc_x];                          \
+    fixed_t         frac = dc_texturemid + (dc_yl - centery) * dc_iscale;               \
+    const fixed_t   height = dc_texheight << FRACBITS;                                  \
+    byte            dot;                                                                \
+    COLORMAP_##light;                                                                   \
+                                                                                        \
+    if (frac < 0)                                                                       \
+        while ((frac += height) < 0);                                                   \
+    else                                                                                \
+        while (frac >= height)                                                          \
+            frac -= height;                                                             \
+                                                                                        \
+    while (--count)                                                                     \
+    {                                                                                   \
+        dot = dc_source[frac >> FRACBITS];                                              \
+        *dest = LIGHT_##light(dot, dc_yl++)[dot];                                       \
+        dest += columnpitch;                                                            \
+                                                                                        \
+        if ((frac += dc_iscale) >= height)                                              \
+            frac -= height;                                                             \
+    }                                                                                   \
+                                                                                        \
+    dot = dc_source[frac >> FRACBITS];                                                  \
+    *dest = LIGHT_##light(dot, dc_yl)[dot];                                             \
+}                                                                                       \
+                                                                                        \
+void name(void)                                                                         \
+{                                                                                       \
+    if (dc_texheight & (dc_texheight - 1))                                              \
+        name##NonPow2();                                                                \
+    else                                                                                \
+        name##Pow2();                                                                   \
+}
+
+#define DRAWCOLORCOLUMN(name, light)                                                    \
+void name(void)                                                                         \
+{                                                                                       \
+    int     count = dc_yh - dc_yl + 1;                                                  \
+    byte    *dest = ylookup0[dc_yl] + columnofs[dc_x];                                  \
+    COLOR_##light(dc_colormap[0], dc_nextcolormap[0]);                                  \
+                                                                                        \
+    while (--count)                                                                     \
+    {                                                                                   \
+        *dest = SHADE_##light(dc_x, dc_yl++, dc_z);                                     \
+        dest += columnpitch;                                                            \
+    }                                                                                   \
+                                                                                        \
+    *dest = SHADE_##light(dc_x, dc_yl, dc_z);                                           \
+}
+
+#define DRAWTRANSLUCENTCOLORCOLUMN(name, light, tinttab)                                \
+void name(void)                                                                         \
+{                                                                                       \
+    int     count = dc_yh - dc_yl + 1;                                                  \
+    byte    *dest = ylookup0[dc_yl] + dc_x;                                             \
+    COLOR_##light(dc_colormap[0], dc_nextcolormap[0]);                                  \
+                                                                                        \
+    while (--count)                                                                     \
+    {                                                                                   \
+        *dest = tinttab[(*dest << 8) + SHADE_##light(dc_x, dc_yl++, dc_z)];             \
+        dest += SCREENWIDTH;                                                            \
+    }                                                                                   \
+                                                                                        \
+    *dest = tinttab[(*dest << 8) + SHADE_##light(dc_x, dc_yl, dc_z)];                   \
+}
+
+#define DRAWSPAN(name, light)                                                           \
+void name(void)                                                                         \
+{                                                                                       \
+    int     count = ds_x2 - ds_x1;                                                      \
+    byte    *dest = ylookup0[ds_y] + columnofs[ds_x1];                                  \
+    SPANCOLORMAP_##light;                                                               \
+                                                                                        \
+    while (--count)                                                                     \
+    {                                                                                   \
+        *dest = SPANLIGHT_##light(ds_x1++)[SPANTEXEL];                                  \
+        dest += spanpitch;                                                              \
+        ds_xfrac += ds_xstep;                                                           \
+        ds_yfrac += ds_ystep;                                                           \
+    }                                                                                   \
+                                                                                        \
+    *dest = SPANLIGHT_##light(ds_x1)[SPANTEXEL];                                        \
+}
+
+#define DRAWCOLORSPAN(name, light)                                                      \
+void name(void)                                                                         \
+{                                                                                       \
+    int     count = ds_x2 - ds_x1;                                                      \
+    byte    *dest = ylookup0[ds_y] + columnofs[ds_x1];                                  \
+    COLOR_##light(ds_colormap[0], ds_colormap[1]);                                      \
+                                                                                        \
+    while (--count)                                                                     \
+    {                                                                                   \
+        *dest = SHADE_##light(ds_x1++, ds_y, ds_z);                                     \
+        dest += spanpitch;                                                              \
+    }                                                                                   \
+                                                                                        \
+    *dest = SHADE_##light(ds_x1, ds_y, ds_z);                                           \
 }
 
-void R_DrawTranslucent50ColorColumn(void)
+//
+// A column is a vertical slice/span from a wall texture that,
+//  given the DOOM style restrictions on the view orientation,
+//  will always have constant z-depth.
+// Thus a special case loop for very fast rendering can
+//  be used. It has also been used with Wolfenstein 3D.
+//
+DRAWCOLUMN(R_DrawColumn, FLAT, TEXEL)
+DRAWCOLUMN(R_DrawDitherLowColumn, DITHERLOW, TEXEL)
+DRAWCOLUMN(R_DrawDitherColumn, DITHER, TEXEL)
+DRAWCOLUMN(R_DrawBrightmapColumn, BRIGHTMAP, TEXEL)
+DRAWCOLUMN(R_DrawBrightmapDitherLowColumn, BRIGHTMAPDITHERLOW, TEXEL)
+DRAWCOLUMN(R_DrawBrightmapDitherColumn, BRIGHTMAPDITHER, TEXEL)
+DRAWCOLUMN(R_DrawCorrectedColumn, FLAT, CORRECTED)
+DRAWCOLUMN(R_DrawCorrectedDitherLowColumn, DITHERLOW, CORRECTED)
+DRAWCOLUMN(R_DrawCorrectedDitherColumn, DITHER, CORRECTED)
+
+DRAWCOLORCOLUMN(R_DrawColorColumn, FLAT)
+DRAWCOLORCOLUMN(R_DrawColorDitherLowColumn, DITHERLOW)
+DRAWCOLORCOLUMN(R_DrawColorDitherColumn, DITHER)
+
+void R_DrawShadowColumn(void)
 {
-    int     count = dc_yh - dc_yl + 1;
+    int     count = dc_yh - dc_yl;
     byte    *dest = ylookup0[dc_yl] + dc_x;
 
-    while (--count)
+    if (count)
     {
-        *dest = tranmap[(*dest << 8) + NOTEXTURECOLOR];
+        *dest = *(*dest + dc_black33);
         dest += SCREENWIDTH;
-    }
-
-    *dest = tranmap[(*dest << 8) + NOTEXTURECOLOR];
-}
 
-void R_DrawTranslucent50ColorDitherLowColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    const lighttable_t  *colormap[2] = { dc_colormap[0], dc_nextcolormap[0] };
+        while (--count)
+        {
+            *dest = *(*dest + dc_black40);
+            dest += SCREENWIDTH;
+        }
 
-    while (--count)
-    {
-        *dest = tranmap[(*dest << 8) + colormap[ditherlow(dc_x, dc_yl++, dc_z)][NOTEXTURECOLOR]];
-        dest += SCREENWIDTH;
+        *dest = *(*dest + (dc_yh == dc_floorclip ? dc_black40 : dc_black33));
     }
-
-    *dest = tranmap[(*dest << 8) + colormap[ditherlow(dc_x, dc_yl, dc_z)][NOTEXTURECOLOR]];
+    else
+        *dest = *(*dest + dc_black33);
 }
 
-void R_DrawTranslucent50ColorDitherColumn(void)
+void R_DrawFuzzyShadowColumn(void)
 {
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    const lighttable_t  *colormap[2] = { dc_colormap[0], dc_nextcolormap[0] };
-
-    while (--count)
-    {
-        *dest = tranmap[(*dest << 8) + colormap[dither(dc_x, dc_yl++, dc_z)][NOTEXTURECOLOR]];
-        dest += SCREENWIDTH;
-    }
+    byte    *dest;
+    int     count;
 
-    *dest = tranmap[(*dest << 8) + colormap[dither(dc_x, dc_yl, dc_z)][NOTEXTURECOLOR]];
-}
+    if (dc_x & 1)
+        return;
 
-void R_DrawTranslucent33Column(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap = dc_colormap[0];
+    dest = ylookup0[dc_yl] + dc_x;
 
-    while (--count)
+    if ((count = dc_yh - dc_yl))
     {
-        *dest = tinttab33[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
+        *dest = *(*dest + dc_black33);
+        *(dest + 1) = *(*(dest + 1) + dc_black33);
         dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
-
-    *dest = tinttab33[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-}
 
-void R_DrawTranslucentRedColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap = dc_colormap[0];
+        while (--count)
+        {
+            *dest = *(*dest + dc_black33);
+            *(dest + 1) = *(*(dest + 1) + dc_black33);
+            dest += SCREENWIDTH;
+        }
 
-    while (--count)
-    {
-        *dest = tinttabred[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
+        *dest = *(*dest + dc_black33);
+        *(dest + 1) = *(*(dest + 1) + dc_black33);
     }
-
-    *dest = tinttabred[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-}
-
-void R_DrawTranslucentRedWhiteColumn1(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap = dc_colormap[0];
-
-    while (--count)
+    else
     {
-        *dest = tinttabredwhite1[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
+        *dest = *(*dest + dc_black33);
+        *(dest + 1) = *(*(dest + 1) + dc_black33);
     }
-
-    *dest = tinttabredwhite1[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
 }
 
-void R_DrawTranslucentRedWhiteColumn2(void)
+void R_DrawSolidShadowColumn(void)
 {
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap = dc_colormap[0];
+    int     count = dc_yh - dc_yl + 1;
+    byte    *dest = ylookup0[dc_yl] + dc_x;
 
     while (--count)
     {
-        *dest = tinttabredwhite2[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
+        *dest = dc_black;
         dest += SCREENWIDTH;
-        frac += dc_iscale;
     }
 
-    *dest = tinttabredwhite2[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
+    *dest = dc_black;
 }
 
-void R_DrawTranslucentRedWhite50Column(void)
+void R_DrawBloodSplatColumn(void)
 {
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap = dc_colormap[0];
+    int     count = dc_yh - dc_yl + 1;
+    byte    *dest = ylookup0[dc_yl] + dc_x;
 
     while (--count)
     {
-        *dest = tinttabredwhite50[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
+        *dest = *(*dest + dc_bloodcolor);
         dest += SCREENWIDTH;
-        frac += dc_iscale;
     }
 
-    *dest = tinttabredwhite50[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
+    *dest = *(*dest + dc_bloodcolor);
 }
 
-void R_DrawTranslucentGreenColumn(void)
+void R_DrawSolidBloodSplatColumn(void)
 {
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap = dc_colormap[0];
+    int     count = dc_yh - dc_yl + 1;
+    byte    *dest = ylookup0[dc_yl] + dc_x;
 
     while (--count)
     {
-        *dest = tinttabgreen[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
+        *dest = dc_solidbloodcolor;
         dest += SCREENWIDTH;
-        frac += dc_iscale;
     }
 
-    *dest = tinttabgreen[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
+    *dest = dc_solidbloodcolor;
 }
 
-void R_DrawTranslucentBlueColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap = dc_colormap[0];
-
-    while (--count)
-    {
-        *dest = tinttabblue[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
-
-    *dest = tinttabblue[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-}
+DRAWWALLCOLUMN(R_DrawWallColumn, FLAT)
+DRAWWALLCOLUMN(R_DrawDitherLowWallColumn, DITHERLOW)
+DRAWWALLCOLUMN(R_DrawDitherWallColumn, DITHER)
+DRAWWALLCOLUMN(R_DrawBrightmapWallColumn, BRIGHTMAP)
+DRAWWALLCOLUMN(R_DrawBrightmapDitherLowWallColumn, BRIGHTMAPDITHERLOW)
+DRAWWALLCOLUMN(R_DrawBrightmapDitherWallColumn, BRIGHTMAPDITHER)
 
-void R_DrawTranslucentRed33Column(void)
+void R_DrawPlayerSpriteColumn(void)
 {
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap = dc_colormap[0];
+    int     count = dc_yh - dc_yl + 1;
+    byte    *dest = ylookup1[dc_yl] + dc_x;
+    fixed_t frac = dc_texturefrac;
 
     while (--count)
     {
-        *dest = tinttabred33[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
+        *dest = dc_source[frac >> FRACBITS];
         dest += SCREENWIDTH;
         frac += dc_iscale;
     }
 
-    *dest = tinttabred33[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
+    *dest = dc_source[frac >> FRACBITS];
 }
 
-void R_DrawTranslucentGreen33Column(void)
+void R_DrawFlippedSkyColumn(void)
 {
     int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
+    byte                *dest = ylookup0[dc_yl] + columnofs[dc_x];
+    fixed_t             frac = dc_texturemid + (dc_yl - centery) * dc_iscale;
     const lighttable_t  *colormap = dc_colormap[0];
+    fixed_t             i;
 
     while (--count)
     {
-        *dest = tinttabgreen33[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
+        *dest = colormap[dc_source[((i = frac >> FRACBITS) < 128 ? i : 126 - (i & 127))]];
+        dest += columnpitch;
         frac += dc_iscale;
     }
 
-    *dest = tinttabgreen33[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
+    *dest = colormap[dc_source[((i = frac >> FRACBITS) < 128 ? i : 126 - (i & 127))]];
 }
 
-void R_DrawTranslucentBlue25Column(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap = dc_colormap[0];
-
-    while (--count)
-    {
-        *dest = tinttabblue25[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
-
-    *dest = tinttabblue25[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-}
+DRAWTRANSLUCENTCOLUMN(R_DrawTranslucentBloodColumn, FLAT, TRANSLATED, tinttab33)
+DRAWTRANSLUCENTCOLUMN(R_DrawTranslucentColumn, FLAT, TEXEL, tinttabadditive)
+DRAWTRANSLUCENTCOLUMN(R_DrawTranslucent50Column, FLAT, TEXEL, tranmap)
+DRAWTRANSLUCENTCOLUMN(R_DrawDitherLowTranslucent50Column, DITHERLOW, TEXEL, tranmap)
+DRAWTRANSLUCENTCOLUMN(R_DrawDitherTranslucent50Column, DITHER, TEXEL, tranmap)
+DRAWTRANSLUCENTCOLUMN(R_DrawCorrectedTranslucent50Column, FLAT, CORRECTED, tranmap)
+DRAWTRANSLUCENTCOLUMN(R_DrawTranslucent33Column, FLAT, TEXEL, tinttab33)
+DRAWTRANSLUCENTCOLUMN(R_DrawTranslucentRedColumn, FLAT, TEXEL, tinttabred)
+DRAWTRANSLUCENTCOLUMN(R_DrawTranslucentRedWhiteColumn1, FLAT, TEXEL, tinttabredwhite1)
+DRAWTRANSLUCENTCOLUMN(R_DrawTranslucentRedWhiteColumn2, FLAT, TEXEL, tinttabredwhite2)
+DRAWTRANSLUCENTCOLUMN(R_DrawTranslucentRedWhite50Column, FLAT, TEXEL, tinttabredwhite50)
+DRAWTRANSLUCENTCOLUMN(R_DrawTranslucentGreenColumn, FLAT, TEXEL, tinttabgreen)
+DRAWTRANSLUCENTCOLUMN(R_DrawTranslucentBlueColumn, FLAT, TEXEL, tinttabblue)
+DRAWTRANSLUCENTCOLUMN(R_DrawTranslucentRed33Column, FLAT, TEXEL, tinttabred33)
+DRAWTRANSLUCENTCOLUMN(R_DrawTranslucentGreen33Column, FLAT, TEXEL, tinttabgreen33)
+DRAWTRANSLUCENTCOLUMN(R_DrawTranslucentBlue25Column, FLAT, TEXEL, tinttabblue25)
+
+DRAWTRANSLUCENTCOLORCOLUMN(R_DrawTranslucent50ColorColumn, UNLIT, tranmap)
+DRAWTRANSLUCENTCOLORCOLUMN(R_DrawTranslucent50ColorDitherLowColumn, DITHERLOW, tranmap)
+DRAWTRANSLUCENTCOLORCOLUMN(R_DrawTranslucent50ColorDitherColumn, DITHER, tranmap)
 
 void R_DrawFuzzColumn(void)
 {
@@ -1101,56 +576,9 @@ void R_DrawFuzzColumns(void)
 //
 byte    translationtables[256 * 3];
 
-void R_DrawTranslatedColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap = dc_colormap[0];
-
-    while (--count)
-    {
-        *dest = colormap[dc_translation[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
-
-    *dest = colormap[dc_translation[dc_source[frac >> FRACBITS]]];
-}
-
-void R_DrawDitherLowTranslatedColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap[2] = { dc_colormap[0], dc_nextcolormap[0] };
-
-    while (--count)
-    {
-        *dest = colormap[ditherlow(dc_x, dc_yl++, dc_z)][dc_translation[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
-
-    *dest = colormap[ditherlow(dc_x, dc_yl, dc_z)][dc_translation[dc_source[frac >> FRACBITS]]];
-}
-
-void R_DrawDitherTranslatedColumn(void)
-{
-    int                 count = dc_yh - dc_yl + 1;
-    byte                *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t             frac = dc_texturefrac;
-    const lighttable_t  *colormap[2] = { dc_colormap[0], dc_nextcolormap[0] };
-
-    while (--count)
-    {
-        *dest = colormap[dither(dc_x, dc_yl++, dc_z)][dc_translation[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
-        frac += dc_iscale;
-    }
-
-    *dest = colormap[dither(dc_x, dc_yl, dc_z)][dc_translation[dc_source[frac >> FRACBITS]]];
-}
+DRAWCOLUMN(R_DrawTranslatedColumn, FLAT, TRANSLATED)
+DRAWCOLUMN(R_DrawDitherLowTranslatedColumn, DITHERLOW, TRANSLATED)
+DRAWCOLUMN(R_DrawDitherTranslatedColumn, DITHER, TRANSLATED)
 
 //
 // R_InitTranslationTables
@@ -1209,84 +637,84 @@ byte            *ds_source;
 //
 // Draws the actual span.
 //
-void R_DrawSpan(void)
-{
-    int                 count = ds_x2 - ds_x1;
-    byte                *dest = ylookup0[ds_y] + ds_x1;
-    const lighttable_t  *colormap = ds_colormap[0];
-
-    while (--count)
-    {
-        *dest++ = colormap[ds_source[((ds_xfrac >> 16) & 63) | ((ds_yfrac >> 10) & 4032)]];
-        ds_xfrac += ds_xstep;
-        ds_yfrac += ds_ystep;
-    }
+DRAWSPAN(R_DrawSpan, FLAT)
+DRAWSPAN(R_DrawDitherLowSpan, DITHERLOW)
+DRAWSPAN(R_DrawDitherSpan, DITHER)
 
-    *dest = colormap[ds_source[((ds_xfrac >> 16) & 63) | ((ds_yfrac >> 10) & 4032)]];
-}
+DRAWCOLORSPAN(R_DrawColorSpan, FLAT)
+DRAWCOLORSPAN(R_DrawDitherLowColorSpan, DITHERLOW)
+DRAWCOLORSPAN(R_DrawDitherColorSpan, DITHER)
 
-void R_DrawDitherLowSpan(void)
+//
+// R_SetRowMajor
+// Draw directly into screens[0], one row after another.
+//
+static void R_SetRowMajor(void)
 {
-    int     count = ds_x2 - ds_x1;
-    byte    *dest = ylookup0[ds_y] + ds_x1;
+    for (int i = 0, y = viewwindowy * SCREENWIDTH + viewwindowx; i < viewheight; i++, y += SCREENWIDTH)
+        ylookup0[i] = screens[0] + y;
 
-    while (--count)
-    {
-        *dest++ = ds_colormap[ditherlow(ds_x1++, ds_y, ds_z)][ds_source[((ds_xfrac >> 16) & 63) | ((ds_yfrac >> 10) & 4032)]];
-        ds_xfrac += ds_xstep;
-        ds_yfrac += ds_ystep;
-    }
+    for (int i = 0; i < viewwidth; i++)
+        columnofs[i] = i;
 
-    *dest = ds_colormap[ditherlow(ds_x1, ds_y, ds_z)][ds_source[((ds_xfrac >> 16) & 63) | ((ds_yfrac >> 10) & 4032)]];
+    columnpitch = SCREENWIDTH;
+    spanpitch = 1;
 }
 
-void R_DrawDitherSpan(void)
+//
+// R_StartColumnMajor
+// Draw into columnmajorbuffer instead, one column after another, so that
+// each column drawn is contiguous in memory.
+//
+void R_StartColumnMajor(void)
 {
-    int     count = ds_x2 - ds_x1;
-    byte    *dest = ylookup0[ds_y] + ds_x1;
+    for (int i = 0; i < viewheight; i++)
+        ylookup0[i] = columnmajorbuffer + i;
 
-    while (--count)
-    {
-        *dest++ = ds_colormap[dither(ds_x1++, ds_y, ds_z)][ds_source[((ds_xfrac >> 16) & 63) | ((ds_yfrac >> 10) & 4032)]];
-        ds_xfrac += ds_xstep;
-        ds_yfrac += ds_ystep;
-    }
+    for (int i = 0; i < viewwidth; i++)
+        columnofs[i] = i * viewheight;
 
-    *dest = ds_colormap[dither(ds_x1, ds_y, ds_z)][ds_source[((ds_xfrac >> 16) & 63) | ((ds_yfrac >> 10) & 4032)]];
+    columnpitch = 1;
+    spanpitch = viewheight;
 }
 
-void R_DrawColorSpan(void)
+//
+// R_FinishColumnMajor
+// Transpose columnmajorbuffer into screens[0] in square tiles, so that both
+// the columns read and the rows written by each tile stay in the cache, and
+// then go back to drawing directly into screens[0].
+//
+#define TRANSPOSETILESIZE   32
+
+void R_FinishColumnMajor(void)
 {
-    int         count = ds_x2 - ds_x1;
-    byte        *dest = ylookup0[ds_y] + ds_x1;
-    const byte  color = ds_colormap[0][NOTEXTURECOLOR];
+    byte    *dest = screens[0] + viewwindowy * SCREENWIDTH + viewwindowx;
 
-    while (--count)
-        *dest++ = color;
+    for (int x1 = 0; x1 < viewwidth; x1 += TRANSPOSETILESIZE)
+    {
+        const int   x2 = MIN(x1 + TRANSPOSETILESIZE, viewwidth);
 
-    *dest = color;
-}
+        for (int y1 = 0; y1 < viewheight; y1 += TRANSPOSETILESIZE)
+        {
+            const int   y2 = MIN(y1 + TRANSPOSETILESIZE, viewheight);
 
-void R_DrawDitherLowColorSpan(void)
-{
-    int     count = ds_x2 - ds_x1;
-    byte    *dest = ylookup0[ds_y] + ds_x1;
+            for (int y = y1; y < y2; y++)
+            {
+                byte        *row = dest + y * SCREENWIDTH;
+                const byte  *source = columnmajorbuffer + y;
 
-    while (--count)
-        *dest++ = ds_colormap[ditherlow(ds_x1++, ds_y, ds_z)][NOTEXTURECOLOR];
+                for (int x = x1; x < x2; x++)
+                    row[x] = source[x * viewheight];
+            }
+        }
+    }
 
-    *dest = ds_colormap[ditherlow(ds_x1, ds_y, ds_z)][NOTEXTURECOLOR];
+    R_SetRowMajor();
 }
 
-void R_DrawDitherColorSpan(void)
+void R_FillColumnMajor(const byte color)
 {
-    int     count = ds_x2 - ds_x1;
-    byte    *dest = ylookup0[ds_y] + ds_x1;
-
-    while (--count)
-        *dest++ = ds_colormap[dither(ds_x1++, ds_y, ds_z)][NOTEXTURECOLOR];
-
-    *dest = ds_colormap[dither(ds_x1, ds_y, ds_z)][NOTEXTURECOLOR];
+    memset(columnmajorbuffer, color, (size_t)viewwidth * viewheight);
 }
 
 //
@@ -1297,10 +725,9 @@ void R_InitBuffer(void)
     const int   end = (viewwindowy + viewheight) * SCREENWIDTH + viewwindowx + viewwidth;
 
     for (int i = 0, y = viewwindowy * SCREENWIDTH + viewwindowx; y < end; i++, y += SCREENWIDTH)
-    {
-        ylookup0[i] = screens[0] + y;
         ylookup1[i] = screens[1] + y;
-    }
+
+    R_SetRowMajor();
 
     fuzzrange[0] = -SCREENWIDTH * 2;
     fuzzrange[1] = 0;
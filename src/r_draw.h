@@ -162,6 +162,9 @@ void R_DrawDitherLowColorSpan(void);
 void R_DrawDitherColorSpan(void);
 
 void R_InitBuffer(void);
+void R_StartColumnMajor(void);
+void R_FinishColumnMajor(void);
+void R_FillColumnMajor(const byte color);
 
 // Initialize color translation tables,
 //  for player rendering etc.
@@ -74,6 +74,11 @@ fixed_t             viewsin;
 
 fixed_t             viewheightfrac;
 
+// the 3D view is rendered at 1/viewscale of its size when r_detail is low
+int                 viewscale = 1;
+int                 renderwidth;
+static int          renderheight;
+
 player_t            *viewplayer = NULL;
 
 angle_t             clipangle;
@@ -372,31 +377,12 @@ void R_SetViewSize(int blocks)
 }
 
 //
-// R_ExecuteSetViewSize
+// R_InitViewTables
 //
-void R_ExecuteSetViewSize(void)
+static void R_InitViewTables(void)
 {
     fixed_t num;
 
-    setsizeneeded = false;
-
-    if (setblocks == 11)
-    {
-        viewwidth = SCREENWIDTH;
-        viewheight = SCREENHEIGHT;
-        viewwindowx = 0;
-        viewwindowy = 0;
-        pspritescale = FixedDiv(NONWIDEWIDTH, VANILLAWIDTH);
-    }
-    else
-    {
-        viewwidth = setblocks * SCREENWIDTH / 10;
-        viewheight = ((setblocks * (SCREENHEIGHT - SBARHEIGHT) / 10) & ~7);
-        viewwindowx = (SCREENWIDTH - viewwidth) / 2;
-        viewwindowy = (SCREENHEIGHT - SBARHEIGHT - viewheight) / 2;
-        pspritescale = FixedDiv(setblocks * NONWIDEWIDTH / 10, VANILLAWIDTH);
-    }
-
     centerx = viewwidth / 2;
     centerxfrac = centerx << FRACBITS;
     fovscale = finetangent[FINEANGLES / 4 + ((menuactive && !helpscreen && menuspin ? r_fov_max : r_fov)
@@ -430,7 +416,7 @@ void R_ExecuteSetViewSize(void)
     for (int i = 0; i < viewheight; i++)
         for (int j = 0; j < LOOKDIRS; j++)
             yslopes[j][i] = FixedDiv(num, ABS(((i - (viewheight / 2 + (j - LOOKDIRMAX) * 2
-                * setblocks / 10)) << FRACBITS) + FRACUNIT / 2));
+                * setblocks / (10 * viewscale))) << FRACBITS) + FRACUNIT / 2));
 
     yslope = yslopes[LOOKDIRMAX];
 
@@ -463,6 +449,63 @@ void R_ExecuteSetViewSize(void)
                 c_psprscalelight[k][i][j] = &colormaps[k][level];
         }
     }
+}
+
+//
+// R_ExecuteSetViewSize
+//
+void R_ExecuteSetViewSize(void)
+{
+    setsizeneeded = false;
+
+    if (setblocks == 11)
+    {
+        viewwidth = SCREENWIDTH;
+        viewheight = SCREENHEIGHT;
+        viewwindowx = 0;
+        viewwindowy = 0;
+        pspritescale = FixedDiv(NONWIDEWIDTH, VANILLAWIDTH);
+    }
+    else
+    {
+        viewwidth = setblocks * SCREENWIDTH / 10;
+        viewheight = ((setblocks * (SCREENHEIGHT - SBARHEIGHT) / 10) & ~7);
+        viewwindowx = (SCREENWIDTH - viewwidth) / 2;
+        viewwindowy = (SCREENHEIGHT - SBARHEIGHT - viewheight) / 2;
+        pspritescale = FixedDiv(setblocks * NONWIDEWIDTH / 10, VANILLAWIDTH);
+    }
+
+    // When r_detail is low and r_lowpixelsize is square, build the tables for a view
+    // that is a fraction of the size of the window, so only that many pixels are
+    // drawn. R_RenderPlayerView() then blows it back up to fill the window.
+    if (r_detail == r_detail_low && lowpixelscale > 1 && viewheight / lowpixelscale >= 8)
+    {
+        const int   width = viewwidth;
+        const int   height = viewheight;
+
+        viewscale = lowpixelscale;
+        viewwidth /= viewscale;
+        viewheight /= viewscale;
+        pspritescale /= viewscale;
+
+        R_InitViewTables();
+
+        renderwidth = viewwidth;
+        renderheight = viewheight;
+        viewwidth = width;
+        viewheight = height;
+    }
+    else
+    {
+        viewscale = 1;
+        R_InitViewTables();
+
+        renderwidth = viewwidth;
+        renderheight = viewheight;
+    }
+
+    if (gamestate == GS_LEVEL)
+        R_InitSkyScale();
 
     AM_SetAutomapSize(r_screensize);
 }
@@ -587,279 +630,184 @@ void R_UpdateMobjColfunc(mobj_t *mobj)
     }
 }
 
-void R_InitColumnFunctions(void)
+//
+// The column and span drawers to use for each lighting mode, with
+//  textures both on and off
+//
+enum
 {
-    if (r_textures)
-    {
-        skycolfunc = (canmodify && !transferredsky && (gamemode != commercial || gamemap < 21) && !canfreelook ?
-            &R_DrawFlippedSkyColumn : &R_DrawWallColumn);
+    lighting_flat,
+    lighting_dither,
+    lighting_ditherlow,
+    NUMLIGHTINGMODES
+};
 
-        if (r_ditheredlighting)
-        {
-            if (r_detail == r_detail_low)
-            {
-                basecolfunc = &R_DrawDitherLowColumn;
-                translatedcolfunc = &R_DrawDitherLowTranslatedColumn;
-                wallcolfunc = &R_DrawDitherLowWallColumn;
-                missingcolfunc = &R_DrawColorDitherLowColumn;
-                bmapwallcolfunc = &R_DrawBrightmapDitherLowWallColumn;
-                segcolfunc = &R_DrawDitherLowColumn;
-                bmapsegcolfunc = &R_DrawBrightmapDitherLowColumn;
-                tl50segcolfunc = (r_textures_translucency ? &R_DrawDitherLowTranslucent50Column : &R_DrawDitherLowColumn);
-                spanfunc = &R_DrawDitherLowSpan;
-            }
-            else
-            {
-                basecolfunc = &R_DrawDitherColumn;
-                translatedcolfunc = &R_DrawDitherTranslatedColumn;
-                wallcolfunc = &R_DrawDitherWallColumn;
-                missingcolfunc = &R_DrawColorDitherColumn;
-                bmapwallcolfunc = &R_DrawBrightmapDitherWallColumn;
-                segcolfunc = &R_DrawDitherColumn;
-                bmapsegcolfunc = &R_DrawBrightmapDitherColumn;
-                tl50segcolfunc = (r_textures_translucency ? &R_DrawDitherTranslucent50Column : &R_DrawDitherColumn);
-                spanfunc = &R_DrawDitherSpan;
-            }
+typedef struct
+{
+    void (*colfunc)(void);
+    void (*translatedcolfunc)(void);
+    void (*wallcolfunc)(void);
+    void (*missingcolfunc)(void);
+    void (*bmapwallcolfunc)(void);
+    void (*bmapsegcolfunc)(void);
+    void (*tl50segcolfunc)(void);
+    void (*spanfunc)(void);
+} drawfuncs_t;
+
+static const drawfuncs_t texturedfuncs[NUMLIGHTINGMODES] =
+{
+    // lighting_flat
+    {
+        /* colfunc */           &R_DrawColumn,
+        /* translatedcolfunc */ &R_DrawTranslatedColumn,
+        /* wallcolfunc */       &R_DrawWallColumn,
+        /* missingcolfunc */    &R_DrawColorColumn,
+        /* bmapwallcolfunc */   &R_DrawBrightmapWallColumn,
+        /* bmapsegcolfunc */    &R_DrawBrightmapColumn,
+        /* tl50segcolfunc */    &R_DrawTranslucent50Column,
+        /* spanfunc */          &R_DrawSpan
+    },
+    // lighting_dither
+    {
+        /* colfunc */           &R_DrawDitherColumn,
+        /* translatedcolfunc */ &R_DrawDitherTranslatedColumn,
+        /* wallcolfunc */       &R_DrawDitherWallColumn,
+        /* missingcolfunc */    &R_DrawColorDitherColumn,
+        /* bmapwallcolfunc */   &R_DrawBrightmapDitherWallColumn,
+        /* bmapsegcolfunc */    &R_DrawBrightmapDitherColumn,
+        /* tl50segcolfunc */    &R_DrawDitherTranslucent50Column,
+        /* spanfunc */          &R_DrawDitherSpan
+    },
+    // lighting_ditherlow
+    {
+        /* colfunc */           &R_DrawDitherLowColumn,
+        /* translatedcolfunc */ &R_DrawDitherLowTranslatedColumn,
+        /* wallcolfunc */       &R_DrawDitherLowWallColumn,
+        /* missingcolfunc */    &R_DrawColorDitherLowColumn,
+        /* bmapwallcolfunc */   &R_DrawBrightmapDitherLowWallColumn,
+        /* bmapsegcolfunc */    &R_DrawBrightmapDitherLowColumn,
+        /* tl50segcolfunc */    &R_DrawDitherLowTranslucent50Column,
+        /* spanfunc */          &R_DrawDitherLowSpan
+    }
+};
 
-            altwallcolfunc = &R_DrawWallColumn;
-            altbmapwallcolfunc = &R_DrawBrightmapWallColumn;
-            altspanfunc = &R_DrawSpan;
+static const drawfuncs_t untexturedfuncs[NUMLIGHTINGMODES] =
+{
+    // lighting_flat
+    {
+        /* colfunc */           &R_DrawColorColumn,
+        /* translatedcolfunc */ &R_DrawColorColumn,
+        /* wallcolfunc */       &R_DrawColorColumn,
+        /* missingcolfunc */    &R_DrawColorColumn,
+        /* bmapwallcolfunc */   &R_DrawColorColumn,
+        /* bmapsegcolfunc */    &R_DrawColorColumn,
+        /* tl50segcolfunc */    &R_DrawTranslucent50ColorColumn,
+        /* spanfunc */          &R_DrawColorSpan
+    },
+    // lighting_dither
+    {
+        /* colfunc */           &R_DrawColorDitherColumn,
+        /* translatedcolfunc */ &R_DrawColorDitherColumn,
+        /* wallcolfunc */       &R_DrawColorDitherColumn,
+        /* missingcolfunc */    &R_DrawColorDitherColumn,
+        /* bmapwallcolfunc */   &R_DrawColorDitherColumn,
+        /* bmapsegcolfunc */    &R_DrawColorDitherColumn,
+        /* tl50segcolfunc */    &R_DrawTranslucent50ColorDitherColumn,
+        /* spanfunc */          &R_DrawDitherColorSpan
+    },
+    // lighting_ditherlow
+    {
+        /* colfunc */           &R_DrawColorDitherLowColumn,
+        /* translatedcolfunc */ &R_DrawColorDitherLowColumn,
+        /* wallcolfunc */       &R_DrawColorDitherLowColumn,
+        /* missingcolfunc */    &R_DrawColorDitherLowColumn,
+        /* bmapwallcolfunc */   &R_DrawColorDitherLowColumn,
+        /* bmapsegcolfunc */    &R_DrawColorDitherLowColumn,
+        /* tl50segcolfunc */    &R_DrawTranslucent50ColorDitherLowColumn,
+        /* spanfunc */          &R_DrawDitherLowColorSpan
+    }
+};
 
-            if (r_sprites_translucency)
-            {
-                tlcolfunc = &R_DrawTranslucentColumn;
-                tl50colfunc = &R_DrawTranslucent50Column;
-                tl33colfunc = &R_DrawTranslucent33Column;
+static void (*const correctedcolfuncs[NUMLIGHTINGMODES])(void) =
+{
+    &R_DrawCorrectedColumn,
+    &R_DrawCorrectedDitherColumn,
+    &R_DrawCorrectedDitherLowColumn
+};
 
-                if (incompatiblepalette)
-                {
-                    if (r_detail == r_detail_low)
-                    {
-                        tlgreencolfunc = &R_DrawDitherLowColumn;
-                        tlredcolfunc = &R_DrawDitherLowColumn;
-                        tlredwhitecolfunc1 = &R_DrawDitherLowColumn;
-                        tlredwhitecolfunc2 = &R_DrawDitherLowColumn;
-                        tlredwhite50colfunc = &R_DrawDitherLowColumn;
-                        tlbluecolfunc = &R_DrawDitherLowColumn;
-                        tlgreen33colfunc = &R_DrawDitherLowColumn;
-                        tlred33colfunc = &R_DrawDitherLowColumn;
-                        tlblue25colfunc = &R_DrawDitherLowColumn;
-                    }
-                    else
-                    {
-                        tlgreencolfunc = &R_DrawDitherColumn;
-                        tlredcolfunc = &R_DrawDitherColumn;
-                        tlredwhitecolfunc1 = &R_DrawDitherColumn;
-                        tlredwhitecolfunc2 = &R_DrawDitherColumn;
-                        tlredwhite50colfunc = &R_DrawDitherColumn;
-                        tlbluecolfunc = &R_DrawDitherColumn;
-                        tlgreen33colfunc = &R_DrawDitherColumn;
-                        tlred33colfunc = &R_DrawDitherColumn;
-                        tlblue25colfunc = &R_DrawDitherColumn;
-                    }
-                }
-                else
-                {
-                    tlgreencolfunc = &R_DrawTranslucentGreenColumn;
-                    tlredcolfunc = &R_DrawTranslucentRedColumn;
-                    tlredwhitecolfunc1 = &R_DrawTranslucentRedWhiteColumn1;
-                    tlredwhitecolfunc2 = &R_DrawTranslucentRedWhiteColumn2;
-                    tlredwhite50colfunc = &R_DrawTranslucentRedWhite50Column;
-                    tlbluecolfunc = &R_DrawTranslucentBlueColumn;
-                    tlgreen33colfunc = &R_DrawTranslucentGreen33Column;
-                    tlred33colfunc = &R_DrawTranslucentRed33Column;
-                    tlblue25colfunc = &R_DrawTranslucentBlue25Column;
-                }
-            }
-            else
-            {
-                if (r_detail == r_detail_low)
-                {
-                    tlcolfunc = &R_DrawDitherLowColumn;
-                    tl50colfunc = &R_DrawDitherLowColumn;
-                    tl33colfunc = &R_DrawDitherLowColumn;
-                    tlgreencolfunc = &R_DrawDitherLowColumn;
-                    tlredcolfunc = &R_DrawDitherLowColumn;
-                    tlredwhitecolfunc1 = &R_DrawDitherLowColumn;
-                    tlredwhitecolfunc2 = &R_DrawDitherLowColumn;
-                    tlredwhite50colfunc = &R_DrawDitherLowColumn;
-                    tlbluecolfunc = &R_DrawDitherLowColumn;
-                    tlgreen33colfunc = &R_DrawDitherLowColumn;
-                    tlred33colfunc = &R_DrawDitherLowColumn;
-                    tlblue25colfunc = &R_DrawDitherLowColumn;
-                }
-                else
-                {
-                    tlcolfunc = &R_DrawDitherColumn;
-                    tl50colfunc = &R_DrawDitherColumn;
-                    tl33colfunc = &R_DrawDitherColumn;
-                    tlgreencolfunc = &R_DrawDitherColumn;
-                    tlredcolfunc = &R_DrawDitherColumn;
-                    tlredwhitecolfunc1 = &R_DrawDitherColumn;
-                    tlredwhitecolfunc2 = &R_DrawDitherColumn;
-                    tlredwhite50colfunc = &R_DrawDitherColumn;
-                    tlbluecolfunc = &R_DrawDitherColumn;
-                    tlgreen33colfunc = &R_DrawDitherColumn;
-                    tlred33colfunc = &R_DrawDitherColumn;
-                    tlblue25colfunc = &R_DrawDitherColumn;
-                }
-            }
-        }
-        else
-        {
-            basecolfunc = &R_DrawColumn;
-            translatedcolfunc = &R_DrawTranslatedColumn;
-            wallcolfunc = &R_DrawWallColumn;
-            altwallcolfunc = &R_DrawWallColumn;
-            missingcolfunc = &R_DrawColorColumn;
-            bmapwallcolfunc = &R_DrawBrightmapWallColumn;
-            altbmapwallcolfunc = &R_DrawBrightmapWallColumn;
-            segcolfunc = &R_DrawColumn;
-            bmapsegcolfunc = &R_DrawBrightmapColumn;
-            tl50segcolfunc = (r_textures_translucency ? &R_DrawTranslucent50Column : &R_DrawColumn);
-            spanfunc = &R_DrawSpan;
-            altspanfunc = &R_DrawSpan;
-
-            if (r_sprites_translucency)
-            {
-                tlcolfunc = &R_DrawTranslucentColumn;
-                tl50colfunc = &R_DrawTranslucent50Column;
-                tl33colfunc = &R_DrawTranslucent33Column;
+void R_InitColumnFunctions(void)
+{
+    const int           lighting = (!r_ditheredlighting ? lighting_flat :
+                            (r_detail == r_detail_low ? lighting_ditherlow : lighting_dither));
+    const drawfuncs_t   *funcs = (r_textures ? texturedfuncs : untexturedfuncs);
+
+    basecolfunc = funcs[lighting].colfunc;
+    translatedcolfunc = funcs[lighting].translatedcolfunc;
+    wallcolfunc = funcs[lighting].wallcolfunc;
+    altwallcolfunc = funcs[lighting_flat].wallcolfunc;
+    missingcolfunc = funcs[lighting].missingcolfunc;
+    bmapwallcolfunc = funcs[lighting].bmapwallcolfunc;
+    altbmapwallcolfunc = funcs[lighting_flat].bmapwallcolfunc;
+    segcolfunc = funcs[lighting].colfunc;
+    bmapsegcolfunc = funcs[lighting].bmapsegcolfunc;
+    tl50segcolfunc = (r_textures_translucency ? funcs[lighting].tl50segcolfunc : funcs[lighting].colfunc);
+    spanfunc = funcs[lighting].spanfunc;
+    altspanfunc = funcs[lighting_flat].spanfunc;
+
+    if (r_sprites_translucency)
+    {
+        tlcolfunc = (r_textures ? &R_DrawTranslucentColumn : &R_DrawTranslucent50ColorColumn);
+        tl50colfunc = (r_textures ? &R_DrawTranslucent50Column : &R_DrawTranslucent50ColorColumn);
+        tl33colfunc = (r_textures ? &R_DrawTranslucent33Column : &R_DrawTranslucent50ColorColumn);
+    }
+    else
+    {
+        tlcolfunc = basecolfunc;
+        tl50colfunc = basecolfunc;
+        tl33colfunc = basecolfunc;
+    }
 
-                if (incompatiblepalette)
-                {
-                    tlgreencolfunc = &R_DrawColumn;
-                    tlredcolfunc = &R_DrawColumn;
-                    tlredwhitecolfunc1 = &R_DrawColumn;
-                    tlredwhitecolfunc2 = &R_DrawColumn;
-                    tlredwhite50colfunc = &R_DrawColumn;
-                    tlbluecolfunc = &R_DrawColumn;
-                    tlgreen33colfunc = &R_DrawColumn;
-                    tlred33colfunc = &R_DrawColumn;
-                    tlblue25colfunc = &R_DrawColumn;
-                }
-                else
-                {
-                    tlgreencolfunc = &R_DrawTranslucentGreenColumn;
-                    tlredcolfunc = &R_DrawTranslucentRedColumn;
-                    tlredwhitecolfunc1 = &R_DrawTranslucentRedWhiteColumn1;
-                    tlredwhitecolfunc2 = &R_DrawTranslucentRedWhiteColumn2;
-                    tlredwhite50colfunc = &R_DrawTranslucentRedWhite50Column;
-                    tlbluecolfunc = &R_DrawTranslucentBlueColumn;
-                    tlgreen33colfunc = &R_DrawTranslucentGreen33Column;
-                    tlred33colfunc = &R_DrawTranslucentRed33Column;
-                    tlblue25colfunc = &R_DrawTranslucentBlue25Column;
-                }
-            }
-            else
-            {
-                tlcolfunc = &R_DrawColumn;
-                tl50colfunc = &R_DrawColumn;
-                tl33colfunc = &R_DrawColumn;
-                tlgreencolfunc = &R_DrawColumn;
-                tlredcolfunc = &R_DrawColumn;
-                tlredwhitecolfunc1 = &R_DrawColumn;
-                tlredwhitecolfunc2 = &R_DrawColumn;
-                tlredwhite50colfunc = &R_DrawColumn;
-                tlbluecolfunc = &R_DrawColumn;
-                tlgreen33colfunc = &R_DrawColumn;
-                tlred33colfunc = &R_DrawColumn;
-                tlblue25colfunc = &R_DrawColumn;
-            }
-        }
+    if (r_sprites_translucency && r_textures && !incompatiblepalette)
+    {
+        tlgreencolfunc = &R_DrawTranslucentGreenColumn;
+        tlredcolfunc = &R_DrawTranslucentRedColumn;
+        tlredwhitecolfunc1 = &R_DrawTranslucentRedWhiteColumn1;
+        tlredwhitecolfunc2 = &R_DrawTranslucentRedWhiteColumn2;
+        tlredwhite50colfunc = &R_DrawTranslucentRedWhite50Column;
+        tlbluecolfunc = &R_DrawTranslucentBlueColumn;
+        tlgreen33colfunc = &R_DrawTranslucentGreen33Column;
+        tlred33colfunc = &R_DrawTranslucentRed33Column;
+        tlblue25colfunc = &R_DrawTranslucentBlue25Column;
+    }
+    else
+    {
+        tlgreencolfunc = basecolfunc;
+        tlredcolfunc = basecolfunc;
+        tlredwhitecolfunc1 = basecolfunc;
+        tlredwhitecolfunc2 = basecolfunc;
+        tlredwhite50colfunc = basecolfunc;
+        tlbluecolfunc = basecolfunc;
+        tlgreen33colfunc = basecolfunc;
+        tlred33colfunc = basecolfunc;
+        tlblue25colfunc = basecolfunc;
+    }
 
+    if (r_textures)
+    {
+        skycolfunc = (canmodify && !transferredsky && (gamemode != commercial || gamemap < 21) && !canfreelook ?
+            &R_DrawFlippedSkyColumn : &R_DrawWallColumn);
         bloodcolfunc = (r_sprites_translucency ? &R_DrawTranslucentBloodColumn : &R_DrawTranslatedColumn);
-        bloodsplatcolfunc = (r_bloodsplats_translucency ? &R_DrawBloodSplatColumn : &R_DrawSolidBloodSplatColumn);
         psprcolfunc = &R_DrawPlayerSpriteColumn;
     }
     else
     {
         skycolfunc = &R_DrawColorColumn;
-
-        if (r_ditheredlighting)
-        {
-            if (r_detail == r_detail_low)
-            {
-                basecolfunc = &R_DrawColorDitherLowColumn;
-                translatedcolfunc = &R_DrawColorDitherLowColumn;
-                wallcolfunc = &R_DrawColorDitherLowColumn;
-                missingcolfunc = &R_DrawColorDitherLowColumn;
-                bmapwallcolfunc = &R_DrawColorDitherLowColumn;
-                segcolfunc = &R_DrawColorDitherLowColumn;
-                bmapsegcolfunc = &R_DrawColorDitherLowColumn;
-                tl50segcolfunc = (r_textures_translucency ? &R_DrawTranslucent50ColorDitherLowColumn : &R_DrawColorDitherLowColumn);
-                spanfunc = &R_DrawDitherLowColorSpan;
-                tlcolfunc = (r_sprites_translucency ? &R_DrawTranslucent50ColorColumn : &R_DrawColorDitherLowColumn);
-                tl50colfunc = (r_sprites_translucency ? &R_DrawTranslucent50ColorColumn : &R_DrawColorDitherLowColumn);
-                tl33colfunc = (r_sprites_translucency ? &R_DrawTranslucent50ColorColumn : &R_DrawColorDitherLowColumn);
-                tlgreencolfunc = &R_DrawColorDitherLowColumn;
-                tlredcolfunc = &R_DrawColorDitherLowColumn;
-                tlredwhitecolfunc1 = &R_DrawColorDitherLowColumn;
-                tlredwhitecolfunc2 = &R_DrawColorDitherLowColumn;
-                tlredwhite50colfunc = &R_DrawColorDitherLowColumn;
-                tlbluecolfunc = &R_DrawColorDitherLowColumn;
-                tlgreen33colfunc = &R_DrawColorDitherLowColumn;
-                tlred33colfunc = &R_DrawColorDitherLowColumn;
-                tlblue25colfunc = &R_DrawColorDitherLowColumn;
-            }
-            else
-            {
-                basecolfunc = &R_DrawColorDitherColumn;
-                translatedcolfunc = &R_DrawColorDitherColumn;
-                wallcolfunc = &R_DrawColorDitherColumn;
-                missingcolfunc = &R_DrawColorDitherColumn;
-                bmapwallcolfunc = &R_DrawColorDitherColumn;
-                segcolfunc = &R_DrawColorDitherColumn;
-                bmapsegcolfunc = &R_DrawColorDitherColumn;
-                tl50segcolfunc = (r_textures_translucency ? &R_DrawTranslucent50ColorDitherColumn : &R_DrawColorDitherColumn);
-                spanfunc = &R_DrawDitherColorSpan;
-                tlcolfunc = (r_sprites_translucency ? &R_DrawTranslucent50ColorColumn : &R_DrawColorDitherColumn);
-                tl50colfunc = (r_sprites_translucency ? &R_DrawTranslucent50ColorColumn : &R_DrawColorDitherColumn);
-                tl33colfunc = (r_sprites_translucency ? &R_DrawTranslucent50ColorColumn : &R_DrawColorDitherColumn);
-                tlgreencolfunc = &R_DrawColorDitherColumn;
-                tlredcolfunc = &R_DrawColorDitherColumn;
-                tlredwhitecolfunc1 = &R_DrawColorDitherColumn;
-                tlredwhitecolfunc2 = &R_DrawColorDitherColumn;
-                tlredwhite50colfunc = &R_DrawColorDitherColumn;
-                tlbluecolfunc = &R_DrawColorDitherColumn;
-                tlgreen33colfunc = &R_DrawColorDitherColumn;
-                tlred33colfunc = &R_DrawColorDitherColumn;
-                tlblue25colfunc = &R_DrawColorDitherColumn;
-            }
-        }
-        else
-        {
-            basecolfunc = &R_DrawColorColumn;
-            translatedcolfunc = &R_DrawColorColumn;
-            wallcolfunc = &R_DrawColorColumn;
-            missingcolfunc = &R_DrawColorColumn;
-            bmapwallcolfunc = &R_DrawColorColumn;
-            segcolfunc = &R_DrawColorColumn;
-            bmapsegcolfunc = &R_DrawColorColumn;
-            tl50segcolfunc = (r_textures_translucency ? &R_DrawTranslucent50ColorColumn : &R_DrawColorColumn);
-            spanfunc = &R_DrawColorSpan;
-            tlcolfunc = (r_sprites_translucency ? &R_DrawTranslucent50ColorColumn : &R_DrawColorColumn);
-            tl50colfunc = (r_sprites_translucency ? &R_DrawTranslucent50ColorColumn : &R_DrawColorColumn);
-            tl33colfunc = (r_sprites_translucency ? &R_DrawTranslucent50ColorColumn : &R_DrawColorColumn);
-            tlgreencolfunc = &R_DrawColorColumn;
-            tlredcolfunc = &R_DrawColorColumn;
-            tlredwhitecolfunc1 = &R_DrawColorColumn;
-            tlredwhitecolfunc2 = &R_DrawColorColumn;
-            tlredwhite50colfunc = &R_DrawColorColumn;
-            tlbluecolfunc = &R_DrawColorColumn;
-            tlgreen33colfunc = &R_DrawColorColumn;
-            tlred33colfunc = &R_DrawColorColumn;
-            tlblue25colfunc = &R_DrawColorColumn;
-        }
-
         bloodcolfunc = (r_sprites_translucency ? &R_DrawTranslucent50ColorColumn : &R_DrawColorColumn);
-        bloodsplatcolfunc = (r_bloodsplats_translucency ? &R_DrawBloodSplatColumn : &R_DrawSolidBloodSplatColumn);
         psprcolfunc = &R_DrawColorColumn;
-        altwallcolfunc = &R_DrawColorColumn;
-        altbmapwallcolfunc = &R_DrawColorColumn;
-        altspanfunc = &R_DrawColorSpan;
     }
 
+    bloodsplatcolfunc = (r_bloodsplats_translucency ? &R_DrawBloodSplatColumn : &R_DrawSolidBloodSplatColumn);
+
     for (mobjtype_t i = 0; i < nummobjtypes; i++)
     {
         mobjinfo_t  *info = &mobjinfo[i];
@@ -931,40 +879,8 @@ void R_InitColumnFunctions(void)
         }
     }
 
-    if (r_ditheredlighting)
-    {
-        if (r_rockettrails_translucency)
-        {
-            mobjinfo[MT_TRAIL].colfunc = &R_DrawCorrectedTranslucent50Column;
-            mobjinfo[MT_TRAIL].altcolfunc = &R_DrawCorrectedTranslucent50Column;
-        }
-        else
-        {
-            if (r_detail == r_detail_low)
-            {
-                mobjinfo[MT_TRAIL].colfunc = &R_DrawCorrectedDitherLowColumn;
-                mobjinfo[MT_TRAIL].altcolfunc = &R_DrawCorrectedDitherLowColumn;
-            }
-            else
-            {
-                mobjinfo[MT_TRAIL].colfunc = &R_DrawCorrectedDitherColumn;
-                mobjinfo[MT_TRAIL].altcolfunc = &R_DrawCorrectedDitherColumn;
-            }
-        }
-    }
-    else
-    {
-        if (r_rockettrails_translucency)
-        {
-            mobjinfo[MT_TRAIL].colfunc = &R_DrawCorrectedTranslucent50Column;
-            mobjinfo[MT_TRAIL].altcolfunc = &R_DrawCorrectedTranslucent50Column;
-        }
-        else
-        {
-            mobjinfo[MT_TRAIL].colfunc = &R_DrawCorrectedColumn;
-            mobjinfo[MT_TRAIL].altcolfunc = &R_DrawCorrectedColumn;
-        }
-    }
+    mobjinfo[MT_TRAIL].colfunc = (r_rockettrails_translucency ? &R_DrawCorrectedTranslucent50Column : correctedcolfuncs[lighting]);
+    mobjinfo[MT_TRAIL].altcolfunc = mobjinfo[MT_TRAIL].colfunc;
 
     if (gamestate == GS_LEVEL)
         for (thinker_t *th = thinkers[th_mobj].cnext; th != &thinkers[th_mobj]; th = th->cnext)
@@ -1085,7 +1001,7 @@ static void R_SetupFrame(void)
     centery = viewheight / 2;
 
     if (pitch)
-        centery += pitch * 2 * (r_screensize + 3) / 10;
+        centery += pitch * 2 * (r_screensize + 3) / (10 * viewscale);
 
     extralight = (viewplayer->extralight << 2) + r_levelbrightness / 3;
 
@@ -1139,10 +1055,11 @@ static void R_SetupFrame(void)
 }
 
 //
-// R_RenderPlayerView
+// R_RenderView
 //
-void R_RenderPlayerView(void)
+static void R_RenderView(void)
 {
+    R_InterpolateMovingSectors();
     R_SetupFrame();
 
     // Clear buffers.
@@ -1157,7 +1074,18 @@ void R_RenderPlayerView(void)
         return;
     }
 
-    if (r_homindicator)
+    if (r_columnmajor)
+    {
+        R_StartColumnMajor();
+
+        if (r_homindicator)
+            R_FillColumnMajor(maptime % 20 < 9 ? nearestred : (viewplayer->fixedcolormap == INVERSECOLORMAP ?
+                colormaps[0][32 * 256 + WHITE] : nearestblack));
+        else if ((viewplayer->cheats & CF_NOCLIP) || freeze)
+            R_FillColumnMajor(viewplayer->fixedcolormap == INVERSECOLORMAP ?
+                colormaps[0][32 * 256 + WHITE] : nearestblack);
+    }
+    else if (r_homindicator)
         V_FillRect(0, viewwindowx, viewwindowy, viewwidth, viewheight,
             (maptime % 20 < 9 ? nearestred : (viewplayer->fixedcolormap == INVERSECOLORMAP ?
                 colormaps[0][32 * 256 + WHITE] : nearestblack)), 0, false, false, NULL, NULL);
@@ -1172,8 +1100,39 @@ void R_RenderPlayerView(void)
 
     R_DrawPlanes();
 
+    // sprites and masked midtextures blend with what is behind them,
+    // so they are always drawn directly into screens[0]
+    if (r_columnmajor)
+        R_FinishColumnMajor();
+
     R_DrawMasked();
 
     if (!r_textures && viewplayer->fixedcolormap == INVERSECOLORMAP)
         V_InvertScreen();
 }
+
+//
+// R_RenderPlayerView
+//
+void R_RenderPlayerView(void)
+{
+    if (viewscale == 1)
+        R_RenderView();
+    else
+    {
+        const int   width = viewwidth;
+        const int   height = viewheight;
+
+        viewwidth = renderwidth;
+        viewheight = renderheight;
+
+        R_RenderView();
+
+        viewwidth = width;
+        viewheight = height;
+
+        if (!automapactive)
+            V_ScaleLowGraphicDetail(screens[0] + viewwindowy * SCREENWIDTH + viewwindowx, SCREENWIDTH,
+                viewwidth, viewheight, renderwidth, renderheight, viewscale, r_antialiasing);
+    }
+}
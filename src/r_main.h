@@ -53,6 +53,8 @@ extern fixed_t  centerxfrac;
 extern fixed_t  centeryfrac;
 extern fixed_t  projection;
 extern fixed_t  viewheightfrac;
+extern int      viewscale;
+extern int      renderwidth;
 
 extern bool     usebrightmaps;
 extern int      validcount;
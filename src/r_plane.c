@@ -39,6 +39,7 @@
 #include "m_menu.h"
 #include "r_sky.h"
 #include "w_wad.h"
+#include "z_zone.h"
 
 #define MAXVISPLANES    1024                    // must be a power of 2
 
@@ -73,8 +74,6 @@ fixed_t             yslopes[LOOKDIRS][MAXHEIGHT];
 
 static fixed_t      cachedheight[MAXHEIGHT];
 
-static bool         updateswirl;
-
 static angle_t      *xtoskyangle;
 
 //
@@ -364,7 +363,19 @@ static void R_MakeSpans(visplane_t *pl)
 // 1 cycle per 32 units (2 in 64)
 #define SWIRLFACTOR2    (FINEANGLES / 32)
 
-static int  offsets[1024 * 4096];
+// The distortion is separable: how far a texel moves horizontally is the sum of
+// one term that depends only on its row and one that depends only on its column,
+// and likewise vertically. So only these four sets of 64 terms need to be
+// calculated each tic, rather than looking up an offset for every texel.
+static int  swirlrowx[64];
+static int  swirlrowy[64];
+static int  swirlcolumnx[64];
+static int  swirlcolumny[64];
+static int  swirltic = -1;
+
+// Each liquid flat is distorted at most once per tic and kept until the next
+static byte **distortedflats;
+static int  *distortedflattics;
 
 //
 // R_InitDistortedFlats
@@ -372,60 +383,61 @@ static int  offsets[1024 * 4096];
 //
 void R_InitDistortedFlats(void)
 {
-    for (int i = 0, *offset = offsets; i < 1024 * SPEED; i += SPEED, offset += 64 * 64)
-        for (int y = 0; y < 64; y++)
-            for (int x = 0; x < 64; x++)
-            {
-                int sinvalue, sinvalue2;
-                int x1, y1;
+    distortedflats = Z_Calloc(numflats, sizeof(*distortedflats), PU_STATIC, NULL);
+    distortedflattics = Z_Malloc(numflats * sizeof(*distortedflattics), PU_STATIC, NULL);
 
-                sinvalue = finesine[((y * SWIRLFACTOR + i * 5 + 900) & FINEMASK)] * 2;
-                sinvalue2 = finesine[((x * SWIRLFACTOR2 + i * 4 + 300) & FINEMASK)] * 2;
-                x1 = x + 128 + (sinvalue >> FRACBITS) + (sinvalue2 >> FRACBITS);
-                sinvalue = finesine[((x * SWIRLFACTOR + i * 3 + 700) & FINEMASK)] * 2;
-                sinvalue2 = finesine[((y * SWIRLFACTOR2 + i * 4 + 1200) & FINEMASK)] * 2;
-                y1 = y + 128 + (sinvalue >> FRACBITS) + (sinvalue2 >> FRACBITS);
+    for (int i = 0; i < numflats; i++)
+        distortedflattics[i] = -1;
+}
 
-                offset[(y << 6) + x] = ((y1 & 63) << 6) + (x1 & 63);
-            }
+//
+// R_SetSwirl
+// Calculate the row and column terms of the distortion for a tic.
+//
+static void R_SetSwirl(const int tic)
+{
+    const int   i = (tic & 1023) * SPEED;
+
+    for (int j = 0; j < 64; j++)
+    {
+        swirlrowx[j] = 128 + ((finesine[(j * SWIRLFACTOR + i * 5 + 900) & FINEMASK] * 2) >> FRACBITS);
+        swirlrowy[j] = j + 128 + ((finesine[(j * SWIRLFACTOR2 + i * 4 + 1200) & FINEMASK] * 2) >> FRACBITS);
+        swirlcolumnx[j] = j + ((finesine[(j * SWIRLFACTOR2 + i * 4 + 300) & FINEMASK] * 2) >> FRACBITS);
+        swirlcolumny[j] = (finesine[(j * SWIRLFACTOR + i * 3 + 700) & FINEMASK] * 2) >> FRACBITS;
+    }
+
+    swirltic = tic;
 }
 
 //
 // R_DistortedFlat
 // Generates a distorted flat from a normal one using a two-dimensional sine wave pattern.
-// [crispy] Optimized to precalculate offsets
 //
 static byte *R_DistortedFlat(const int flatnum)
 {
-    static byte distortedflat[64 * 64];
-    static int  prevflatnum = -1;
-    static int  prevtic = -1;
-    static byte *normalflat;
-    static int  *offset = offsets;
+    byte        *distortedflat = distortedflats[flatnum];
+    const byte  *normalflat;
+    byte        *dest;
 
-    if (prevtic != animatedtic && updateswirl)
-    {
-        offset = &offsets[(animatedtic & 1023) << 12];
-        prevtic = animatedtic;
+    if (!distortedflat)
+        distortedflat = distortedflats[flatnum] = Z_Malloc(64 * 64, PU_STATIC, NULL);
+    else if (distortedflattics[flatnum] == swirltic)
+        return distortedflat;
 
-        if (prevflatnum != flatnum)
-        {
-            normalflat = lumpinfo[firstflat + flatnum]->cache;
-            prevflatnum = flatnum;
-        }
+    normalflat = lumpinfo[firstflat + flatnum]->cache;
+    dest = distortedflat;
 
-        for (int i = 0; i < 64 * 64; i++)
-            distortedflat[i] = normalflat[offset[i]];
-    }
-    else if (prevflatnum != flatnum)
+    for (int y = 0; y < 64; y++)
     {
-        normalflat = lumpinfo[firstflat + flatnum]->cache;
-        prevflatnum = flatnum;
+        const int   rowx = swirlrowx[y];
+        const int   rowy = swirlrowy[y];
 
-        for (int i = 0; i < 64 * 64; i++)
-            distortedflat[i] = normalflat[offset[i]];
+        for (int x = 0; x < 64; x++)
+            *dest++ = normalflat[(((rowy + swirlcolumny[x]) & 63) << 6) + ((rowx + swirlcolumnx[x]) & 63)];
     }
 
+    distortedflattics[flatnum] = swirltic;
+
     return distortedflat;
 }
 
@@ -437,8 +449,9 @@ void R_DrawPlanes(void)
 {
     xtoskyangle = (r_linearskies ? linearskyangle : xtoviewangle);
 
-    if (r_liquid_swirl)
-        updateswirl = !(consoleactive || helpscreen || paused || freeze);
+    if (r_liquid_swirl && swirltic != animatedtic
+        && (swirltic == -1 || !(consoleactive || helpscreen || paused || freeze)))
+        R_SetSwirl(animatedtic);
 
     dc_colormap[0] = (viewplayer->fixedcolormap == INVERSECOLORMAP && r_textures ?
         fixedcolormap : fullcolormap);
@@ -56,9 +56,15 @@ bool        canfreelook = false;
 sky_t       *sky = NULL;
 
 // PSX fire sky <https://fabiensanglard.net/doom_fire_psx/>
+// fireindices[] is stored row by row, and firepixels[] column by column so
+// R_GetFireColumn() can hand it straight to the sky drawer. SpreadFire() keeps
+// both in step.
 static byte fireindices[FIREWIDTH * FIREHEIGHT];
 static byte firepixels[FIREWIDTH * FIREHEIGHT];
 
+// set whenever a column of the fire is drawn, and cleared each time it spreads
+static bool firevisible;
+
 static void PrepareFirePixels(fire_t *fire)
 {
     byte    *rover = firepixels;
@@ -75,23 +81,40 @@ static void PrepareFirePixels(fire_t *fire)
     }
 }
 
-static void SpreadFire(void)
+static void SpreadFire(fire_t *fire)
 {
-    for (int x = 0; x < FIREWIDTH; ++x)
-        for (int y = 1; y < FIREHEIGHT; ++y)
+    const byte  *palette = fire->palette;
+
+    // spread a column at a time, so that each column picks up what the one to
+    // its left has just spread into it
+    for (int x = 0; x < FIREWIDTH; x++)
+    {
+        int bits = 0;
+
+        for (int y = 1; y < FIREHEIGHT; y++, bits >>= 2)
         {
-            const int   src = y * FIREWIDTH + x;
-            const int   index = fireindices[src];
+            const int   index = fireindices[y * FIREWIDTH + x];
+            byte        *dest = &fireindices[(y - 1) * FIREWIDTH];
+
+            // each random number is used 2 bits at a time for the next 8 pixels
+            if (!((y - 1) & 7))
+                bits = M_BigRandom();
 
             if (!index)
-                fireindices[src - FIREWIDTH] = 0;
+            {
+                dest[x] = 0;
+                firepixels[x * FIREHEIGHT + y - 1] = palette[0];
+            }
             else
             {
-                const int   r = M_BigRandom() & 3;
+                const int   r = (bits & 3);
+                const int   j = ((x - r + 1) & (FIREWIDTH - 1));
 
-                fireindices[src - r + 1 - FIREWIDTH] = index - (r & 1);
+                dest[j] = index - (r & 1);
+                firepixels[j * FIREHEIGHT + y - 1] = palette[dest[j]];
             }
         }
+    }
 }
 
 static void SetupFire(fire_t *fire)
@@ -103,19 +126,18 @@ static void SetupFire(fire_t *fire)
     for (int i = 0; i < FIREWIDTH; i++)
         fireindices[(FIREHEIGHT - 1) * FIREWIDTH + i] = last;
 
+    PrepareFirePixels(fire);
+
     for (int i = 0; i < 64; i++)
-        SpreadFire();
+        SpreadFire(fire);
 
-    PrepareFirePixels(fire);
+    firevisible = false;
 }
 
 byte *R_GetFireColumn(int col)
 {
-    while (col < 0)
-        col += FIREWIDTH;
-
-    col %= FIREWIDTH;
-    return &firepixels[col * FIREHEIGHT];
+    firevisible = true;
+    return &firepixels[(col & (FIREWIDTH - 1)) * FIREHEIGHT];
 }
 
 static void InitSkyDefs(void)
@@ -157,8 +179,13 @@ void R_UpdateSky(void)
 
         if (!fire->ticsleft)
         {
-            SpreadFire();
-            PrepareFirePixels(fire);
+            // don't bother if none of the fire was drawn since it last spread
+            if (firevisible)
+            {
+                SpreadFire(fire);
+                firevisible = false;
+            }
+
             fire->ticsleft = fire->updatetime;
         }
 
@@ -254,13 +281,22 @@ void R_InitSkyMap(void)
             skytexturemid = (VANILLAHEIGHT - skyheight) * FRACUNIT * skyheight / SKYSTRETCH_HEIGHT;
         else
             skytexturemid = 0;
-
-        skyiscale = (fixed_t)(((uint64_t)SCREENWIDTH * VANILLAHEIGHT * FRACUNIT) / ((uint64_t)viewwidth * SCREENHEIGHT))
-            * skyheight / SKYSTRETCH_HEIGHT;
     }
     else
-    {
         skytexturemid = VANILLAHEIGHT / 2 * FRACUNIT;
-        skyiscale = (fixed_t)(((uint64_t)SCREENWIDTH * VANILLAHEIGHT * FRACUNIT) / ((uint64_t)viewwidth * SCREENHEIGHT));
-    }
+
+    R_InitSkyScale();
+}
+
+//
+// R_InitSkyScale
+// Based on the width the view is rendered at, which is less than viewwidth
+// when r_detail is low.
+//
+void R_InitSkyScale(void)
+{
+    skyiscale = (fixed_t)(((uint64_t)SCREENWIDTH * VANILLAHEIGHT * FRACUNIT) / ((uint64_t)renderwidth * SCREENHEIGHT));
+
+    if (canfreelook)
+        skyiscale = skyiscale * (textureheight[skytexture] >> FRACBITS) / SKYSTRETCH_HEIGHT;
 }
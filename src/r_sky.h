@@ -57,5 +57,6 @@ extern bool     canfreelook;
 extern sky_t    *sky;
 
 void R_InitSkyMap(void);
+void R_InitSkyScale(void);
 void R_UpdateSky(void);
 byte *R_GetFireColumn(int col);
@@ -50,7 +50,12 @@
 #define BASEYCENTER     (VANILLAHEIGHT / 2)
 
 #define MAXVISSPRITES   256
-#define DS_RANGES_COUNT 3
+
+// drawsegs are indexed by the columns they cover, in a tree of column ranges
+// that halves at each level, so that a sprite only scans the drawsegs in the
+// narrowest range that contains it (extends e6y's split of the view in half)
+#define DS_RANGES_LEVELS    6
+#define DS_RANGES_COUNT     ((1 << DS_RANGES_LEVELS) - 1)
 
 //
 // Sprite rotation 0 is facing the viewer, rotation 1 is one angle turn CLOCKWISE around the axis.
@@ -344,6 +349,12 @@ static void R_InitSpriteDefs(void)
 // GAME FUNCTIONS
 //
 
+typedef struct
+{
+    unsigned int    key;
+    vissprite_t     *spr;
+} vissprite_key_t;
+
 static vissprite_t  *vissprites;
 static vissprite_t  **vissprite_ptrs;
 static unsigned int num_vissprite;
@@ -1232,6 +1243,73 @@ static void R_DrawPlayerSprites(void)
     }
 }
 
+//
+// R_SetDrawSegsXRange
+// Use the drawsegs in the narrowest range of columns that contains x1 to x2.
+//
+static void R_SetDrawSegsXRange(const int x1, const int x2)
+{
+    const int   col1 = BETWEEN(0, x1, viewwidth - 1);
+    const int   col2 = BETWEEN(0, x2, viewwidth - 1);
+
+    for (int level = DS_RANGES_LEVELS - 1; level >= 0; level--)
+    {
+        const int   k = col1 * (1 << level) / viewwidth;
+
+        if (k == col2 * (1 << level) / viewwidth)
+        {
+            const drawsegs_xrange_t *range = &drawsegs_xranges[(1 << level) - 1 + k];
+
+            drawsegs_xrange = range->items;
+            drawsegs_xrange_count = range->count;
+            return;
+        }
+    }
+}
+
+//
+// R_BuildDrawSegsXRanges
+// Add every drawseg that can clip a sprite to the list of each column range it
+// overlaps, keeping the order they are scanned in from end to start.
+//
+static void R_BuildDrawSegsXRanges(void)
+{
+    for (int i = 0; i < DS_RANGES_COUNT; i++)
+        drawsegs_xranges[i].count = 0;
+
+    if (drawsegs_xrange_size < maxdrawsegs)
+    {
+        drawsegs_xrange_size = 2 * maxdrawsegs;
+
+        for (int i = 0; i < DS_RANGES_COUNT; i++)
+            drawsegs_xranges[i].items = I_Realloc(drawsegs_xranges[i].items,
+                drawsegs_xrange_size * sizeof(drawsegs_xranges[i].items[0]));
+    }
+
+    for (drawseg_t *ds = ds_p; ds-- > drawsegs; )
+        if (ds->silhouette || ds->maskedtexturecol)
+        {
+            const int   col1 = BETWEEN(0, ds->x1, viewwidth - 1);
+            const int   col2 = BETWEEN(0, ds->x2, viewwidth - 1);
+
+            for (int level = 0; level < DS_RANGES_LEVELS; level++)
+            {
+                const int   first = (1 << level) - 1;
+                const int   k2 = col2 * (1 << level) / viewwidth;
+
+                for (int k = col1 * (1 << level) / viewwidth; k <= k2; k++)
+                {
+                    drawsegs_xrange_t       *range = &drawsegs_xranges[first + k];
+                    drawseg_xrange_item_t   *item = &range->items[range->count++];
+
+                    item->x1 = ds->x1;
+                    item->x2 = ds->x2;
+                    item->user = ds;
+                }
+            }
+        }
+}
+
 //
 // R_DrawBloodSplatSprite
 //
@@ -1252,12 +1330,15 @@ static void R_DrawBloodSplatSprite(const vissplat_t *splat)
 
     // Scan drawsegs from end to start for obscuring segs.
     // The first drawseg that has a greater scale is the clip seg.
-    for (drawseg_t *ds = ds_p; ds-- > drawsegs; )
+    R_SetDrawSegsXRange(x1, x2);
+
+    for (int j = 0; j < drawsegs_xrange_count; j++)
     {
-        const int   silhouette = ds->silhouette;
+        const drawseg_t *ds = drawsegs_xrange[j].user;
+        const int       silhouette = ds->silhouette;
 
         // determine if the drawseg obscures the blood splat
-        if (ds->x1 > x2 || ds->x2 < x1 || (!silhouette && !ds->maskedtexturecol))
+        if (ds->x1 > x2 || ds->x2 < x1)
             continue;
 
         if (ds->maxscale < scale || (ds->minscale < scale && !R_PointOnSegSide(gx, gy, ds->curline)))
@@ -1326,6 +1407,79 @@ static void msort(vissprite_t **s, vissprite_t **t, unsigned int n)
     }
 }
 
+//
+// R_RadixSortVisSprites
+// Sorts vissprites in order of decreasing scale using an LSD radix sort on the
+// scale, one byte at a time, skipping any byte that is the same in every key.
+// The sort is stable, so the order msort() gives vissprites with the same scale
+// is kept by feeding them in with the higher map index first.
+//
+static void R_RadixSortVisSprites(void)
+{
+    static vissprite_key_t  *keys;
+    static vissprite_key_t  *temp;
+    static unsigned int     num_keys;
+    unsigned int            counts[4][256] = { { 0 } };
+    vissprite_key_t         *src;
+    vissprite_key_t         *dest;
+
+    if (num_keys < num_vissprite)
+    {
+        num_keys = num_vissprite_alloc;
+        keys = I_Realloc(keys, num_keys * sizeof(*keys));
+        temp = I_Realloc(temp, num_keys * sizeof(*temp));
+    }
+
+    for (unsigned int i = 0; i < num_vissprite; i++)
+    {
+        vissprite_t         *spr = vissprites + num_vissprite - 1 - i;
+
+        // flip the sign bit so signed scales order correctly as unsigned keys,
+        // then invert so that the largest scale comes first
+        const unsigned int  key = ~((unsigned int)spr->scale ^ 0x80000000);
+
+        keys[i].key = key;
+        keys[i].spr = spr;
+
+        counts[0][key & 0xFF]++;
+        counts[1][(key >> 8) & 0xFF]++;
+        counts[2][(key >> 16) & 0xFF]++;
+        counts[3][key >> 24]++;
+    }
+
+    src = keys;
+    dest = temp;
+
+    for (int pass = 0; pass < 4; pass++)
+    {
+        const int       shift = pass * 8;
+        unsigned int    *count = counts[pass];
+        unsigned int    offset = 0;
+        vissprite_key_t *swap;
+
+        if (count[(src[0].key >> shift) & 0xFF] == num_vissprite)
+            continue;
+
+        for (int i = 0; i < 256; i++)
+        {
+            const unsigned int  n = count[i];
+
+            count[i] = offset;
+            offset += n;
+        }
+
+        for (unsigned int i = 0; i < num_vissprite; i++)
+            dest[count[(src[i].key >> shift) & 0xFF]++] = src[i];
+
+        swap = src;
+        src = dest;
+        dest = swap;
+    }
+
+    for (unsigned int i = 0; i < num_vissprite; i++)
+        vissprite_ptrs[i] = src[i].spr;
+}
+
 static void R_SortVisSprites(void)
 {
     static unsigned int num_vissprite_ptrs;
@@ -1334,6 +1488,13 @@ static void R_SortVisSprites(void)
         vissprite_ptrs = I_Realloc(vissprite_ptrs,
             (num_vissprite_ptrs = num_vissprite_alloc * 2) * sizeof(*vissprite_ptrs));
 
+    // radix sorting only pays for itself with a lot of vissprites
+    if (num_vissprite >= 128)
+    {
+        R_RadixSortVisSprites();
+        return;
+    }
+
     for (int i = num_vissprite - 1; i >= 0; i--)
         vissprite_ptrs[i] = vissprites + i;
 
@@ -1476,70 +1637,23 @@ void R_DrawMasked(void)
     interpolatesprites = (vid_capfps != TICRATE && !consoleactive && !freeze);
     invulnerable = (viewplayer->fixedcolormap == INVERSECOLORMAP && r_sprites_translucency);
 
+    if (num_vissplat || num_vissprite)
+        R_BuildDrawSegsXRanges();
+
     // draw all blood splats
     for (int i = num_vissplat - 1; i >= 0; i--)
         R_DrawBloodSplatSprite(&vissplats[i]);
 
-    for (int i = 0; i < DS_RANGES_COUNT; i++)
-        drawsegs_xranges[i].count = 0;
-
     if (num_vissprite)
     {
         R_SortVisSprites();
 
-        if (drawsegs_xrange_size < maxdrawsegs)
-        {
-            drawsegs_xrange_size = 2 * maxdrawsegs;
-
-            for (int i = 0; i < DS_RANGES_COUNT; i++)
-                drawsegs_xranges[i].items = I_Realloc(drawsegs_xranges[i].items,
-                    drawsegs_xrange_size * sizeof(drawsegs_xranges[i].items[0]));
-        }
-
-        for (drawseg_t *ds = ds_p; ds-- > drawsegs; )
-            if (ds->silhouette || ds->maskedtexturecol)
-            {
-                drawsegs_xranges[0].items[drawsegs_xranges[0].count].x1 = ds->x1;
-                drawsegs_xranges[0].items[drawsegs_xranges[0].count].x2 = ds->x2;
-                drawsegs_xranges[0].items[drawsegs_xranges[0].count].user = ds;
-
-                // e6y: ~13% of speed improvement on sunder.wad map10
-                if (ds->x1 < centerx)
-                {
-                    drawsegs_xranges[1].items[drawsegs_xranges[1].count] = drawsegs_xranges[0].items[drawsegs_xranges[0].count];
-                    drawsegs_xranges[1].count++;
-                }
-
-                if (ds->x2 >= centerx)
-                {
-                    drawsegs_xranges[2].items[drawsegs_xranges[2].count] = drawsegs_xranges[0].items[drawsegs_xranges[0].count];
-                    drawsegs_xranges[2].count++;
-                }
-
-                drawsegs_xranges[0].count++;
-            }
-
         // draw all other vissprites back to front
         for (int i = num_vissprite - 1; i >= 0; i--)
         {
             const vissprite_t   *spr = vissprite_ptrs[i];
 
-            if (spr->x2 < centerx)
-            {
-                drawsegs_xrange = drawsegs_xranges[1].items;
-                drawsegs_xrange_count = drawsegs_xranges[1].count;
-            }
-            else if (spr->x1 >= centerx)
-            {
-                drawsegs_xrange = drawsegs_xranges[2].items;
-                drawsegs_xrange_count = drawsegs_xranges[2].count;
-            }
-            else
-            {
-                drawsegs_xrange = drawsegs_xranges[0].items;
-                drawsegs_xrange_count = drawsegs_xranges[0].count;
-            }
-
+            R_SetDrawSegsXRange(spr->x1, spr->x2);
             R_DrawSprite(spr);
         }
     }
@@ -325,24 +325,24 @@ void S_StopSounds(void)
         S_StopChannel(cnum);
 }
 
-static int S_GetMusicNum(void)
+static int S_GetMusicNum(const int ep, const int map)
 {
     if (gamemode == commercial)
     {
         if (gamemission == pack_nerve)
-            return nmus[(s_randommusic ? M_RandomIntNoRepeat(1, 9, gamemap) : gamemap) - 1];
+            return nmus[(s_randommusic ? M_RandomIntNoRepeat(1, 9, map) : map) - 1];
         else
-            return (mus_runnin + (s_randommusic ? M_RandomIntNoRepeat(1, 32, gamemap) : gamemap) - 1);
+            return (mus_runnin + (s_randommusic ? M_RandomIntNoRepeat(1, 32, map) : map) - 1);
     }
     else
     {
-        if (gameepisode == 5 && sigil)
-            return (mus_e5m1 + (s_randommusic ? M_RandomIntNoRepeat(1, 9, gamemap) : gamemap) - 1);
-        else if (gameepisode == 6 && sigil2)
-            return (mus_e6m1 + (s_randommusic ? M_RandomIntNoRepeat(1, 9, gamemap) : gamemap) - 1);
+        if (ep == 5 && sigil)
+            return (mus_e5m1 + (s_randommusic ? M_RandomIntNoRepeat(1, 9, map) : map) - 1);
+        else if (ep == 6 && sigil2)
+            return (mus_e6m1 + (s_randommusic ? M_RandomIntNoRepeat(1, 9, map) : map) - 1);
         else
-            return (mus_e1m1 + (s_randommusic ? M_RandomIntNoRepeat(1, 4 * 9, (gameepisode - 1) * 9 + gamemap) :
-                (gameepisode - 1) * 9 + gamemap) - 1);
+            return (mus_e1m1 + (s_randommusic ? M_RandomIntNoRepeat(1, 4 * 9, (ep - 1) * 9 + map) :
+                (ep - 1) * 9 + map) - 1);
     }
 }
 
@@ -356,7 +356,98 @@ void S_Start(void)
     // start new music for the level
     mus_paused = false;
 
-    S_ChangeMusic(S_GetMusicNum(), true, false, true);
+    S_ChangeMusic(S_GetMusicNum(gameepisode, gamemap), true, false, true);
+}
+
+//
+// S_GetMusicLumpNum
+// Chooses the lump to play for some music, and puts its name in namebuf.
+// If update is true, the lump is also remembered for next time.
+//
+static int S_GetMusicLumpNum(const musicnum_t musicnum, const int ep, const int map,
+    const bool mapstart, char *namebuf, const bool update)
+{
+    musicinfo_t *music = &s_music[musicnum];
+    int         lumpnum = music->lumpnum;
+    int         mapinfomusic;
+
+    if (M_StringStartsWith(music->name1, "d_"))
+        M_StringCopy(namebuf, music->name1, 9);
+    else
+    {
+        if (*music->IDKFA && !legacyofrust)
+        {
+            M_StringCopy(namebuf, music->IDKFA, 9);
+
+            if (W_CheckNumForName(namebuf) == -1)
+                M_snprintf(namebuf, 9, "d_%s", music->name1);
+        }
+        else
+            M_snprintf(namebuf, 9, "d_%s", music->name1);
+    }
+
+    // get lumpnum if necessary
+    if (autosigil)
+    {
+        if (musicnum == mus_intro)
+            lumpnum = W_GetLastNumForName(namebuf);
+        else if (musicnum == mus_inter && sigil && sigil2)
+        {
+            if (ep == 5)
+            {
+                M_snprintf(namebuf, 9, "d_%s", music->name1);
+                lumpnum = W_GetXNumForName(namebuf, (buckethead ? 4 : 2));
+            }
+            else if (ep == 6)
+            {
+                M_snprintf(namebuf, 9, "d_%s", music->name1);
+                lumpnum = W_GetXNumForName(namebuf, (thorr && buckethead ? 5 : 3));
+            }
+            else
+                lumpnum = W_GetLastNumForName(namebuf);
+        }
+        else
+            lumpnum = W_CheckNumForName(namebuf);
+    }
+    else if (mapstart && (mapinfomusic = P_GetMapMusic(ep, map)) > 0)
+    {
+        lumpnum = mapinfomusic;
+
+        if (update)
+            M_StringCopy(music->name1, lumpinfo[mapinfomusic]->name, sizeof(music->name1));
+    }
+    else if (!lumpnum)
+        lumpnum = W_CheckNumForName(namebuf);
+
+    if (update)
+        music->lumpnum = lumpnum;
+
+    return lumpnum;
+}
+
+//
+// S_PrecacheMusic
+// Converts the music for a map before it starts, so that
+//  S_Start() finds it already in the MIDI cache.
+//
+void S_PrecacheMusic(const int ep, const int map)
+{
+    int     musicnum;
+    char    namebuf[9];
+    int     lumpnum;
+
+    // the music can't be known yet if it is random
+    if (nomusic || s_randommusic)
+        return;
+
+    if ((musicnum = S_GetMusicNum(ep, map)) <= mus_none || musicnum >= NUMMUSIC)
+        return;
+
+    if ((lumpnum = S_GetMusicLumpNum(musicnum, ep, map, true, namebuf, false)) < 0)
+        return;
+
+    I_PrecacheSong(W_CacheLumpNum(lumpnum), W_LumpLength(lumpnum), lumpnum);
+    W_ReleaseLumpNum(lumpnum);
 }
 
 // [crispy] removed map objects may finish their sounds
@@ -607,7 +698,6 @@ void S_ChangeMusic(const musicnum_t musicnum, const bool looping,
     musicinfo_t *music = &s_music[musicnum];
     char        namebuf[9];
     void        *handle;
-    int         mapinfomusic;
 
     // current music which should play
     musinfo.currentitem = -1;
@@ -619,51 +709,7 @@ void S_ChangeMusic(const musicnum_t musicnum, const bool looping,
     // shutdown old music
     S_StopMusic();
 
-    if (M_StringStartsWith(music->name1, "d_"))
-        M_StringCopy(namebuf, music->name1, sizeof(namebuf));
-    else
-    {
-        if (*music->IDKFA && !legacyofrust)
-        {
-            M_StringCopy(namebuf, music->IDKFA, sizeof(namebuf));
-
-            if (W_CheckNumForName(namebuf) == -1)
-                M_snprintf(namebuf, sizeof(namebuf), "d_%s", music->name1);
-        }
-        else
-            M_snprintf(namebuf, sizeof(namebuf), "d_%s", music->name1);
-    }
-
-    // get lumpnum if necessary
-    if (autosigil)
-    {
-        if (musicnum == mus_intro)
-            music->lumpnum = W_GetLastNumForName(namebuf);
-        else if (musicnum == mus_inter && sigil && sigil2)
-        {
-            if (gameepisode == 5)
-            {
-                M_snprintf(namebuf, sizeof(namebuf), "d_%s", music->name1);
-                music->lumpnum = W_GetXNumForName(namebuf, (buckethead ? 4 : 2));
-            }
-            else if (gameepisode == 6)
-            {
-                M_snprintf(namebuf, sizeof(namebuf), "d_%s", music->name1);
-                music->lumpnum = W_GetXNumForName(namebuf, (thorr && buckethead ? 5 : 3));
-            }
-            else
-                music->lumpnum = W_GetLastNumForName(namebuf);
-        }
-        else
-            music->lumpnum = W_CheckNumForName(namebuf);
-    }
-    else if (mapstart && (mapinfomusic = P_GetMapMusic(gameepisode, gamemap)) > 0)
-    {
-        music->lumpnum = mapinfomusic;
-        M_StringCopy(music->name1, lumpinfo[mapinfomusic]->name, sizeof(music->name1));
-    }
-    else if (!music->lumpnum)
-        music->lumpnum = W_CheckNumForName(namebuf);
+    S_GetMusicLumpNum(musicnum, gameepisode, gamemap, mapstart, namebuf, true);
 
     if (music->lumpnum == -1)
     {
@@ -678,7 +724,7 @@ void S_ChangeMusic(const musicnum_t musicnum, const bool looping,
     // load and register it
     music->data = W_CacheLumpNum(music->lumpnum);
 
-    if (!(handle = I_RegisterSong(music->data, W_LumpLength(music->lumpnum))))
+    if (!(handle = I_RegisterSong(music->data, W_LumpLength(music->lumpnum), music->lumpnum)))
 #if defined(_WIN32)
         if (!midimusictype || !windowsmidi)
 #endif
@@ -758,7 +804,7 @@ void S_ChangeMusInfoMusic(const int lumpnum, const bool looping)
     // load and register it
     music->data = W_CacheLumpNum(lumpnum);
 
-    if (!(handle = I_RegisterSong(music->data, W_LumpLength(lumpnum))))
+    if (!(handle = I_RegisterSong(music->data, W_LumpLength(lumpnum), lumpnum)))
 #if defined(_WIN32)
         if (!midimusictype || !windowsmidi)
 #endif
@@ -69,7 +69,8 @@ void I_ShutdownMusic(void);
 void I_SetMusicVolume(const int volume);
 void I_PauseSong(void);
 void I_ResumeSong(void);
-void *I_RegisterSong(void *data, int size);
+void *I_RegisterSong(void *data, int size, int lumpnum);
+void I_PrecacheSong(void *data, int size, int lumpnum);
 void I_UnregisterSong(void *handle);
 void I_PlaySong(void *handle, const bool looping);
 void I_StopSong(void);
@@ -94,6 +95,7 @@ void S_StopSounds(void);
 //  determines music if any, changes music.
 //
 void S_Start(void);
+void S_PrecacheMusic(const int ep, const int map);
 
 //
 // Start sound for thing at <origin_p>
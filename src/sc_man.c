@@ -33,7 +33,10 @@
 ==============================================================================
 */
 
+#include <ctype.h>
+
 #include "c_console.h"
+#include "i_system.h"
 #include "m_misc.h"
 #include "sc_man.h"
 #include "w_wad.h"
@@ -48,10 +51,12 @@
 char            *sc_String;
 float           sc_Number;
 int             sc_Line;
+int             sc_Column;
 
 static char     *ScriptBuffer;
 static char     *ScriptPtr;
 static char     *ScriptEndPtr;
+static char     *ScriptLineStart;
 static char     *ScriptLumpName;
 static int      ScriptLumpNum;
 static bool     sc_End;
@@ -59,13 +64,30 @@ static bool     ScriptOpen;
 static bool     AlreadyGot;
 static bool     SkipComma;
 
+// The lists passed to SC_MatchString() are hashed the first time each is seen,
+// rather than every string in them being compared against in turn every time.
+#define SC_MAXHASHES    4
+#define SC_HASHSIZE     128
+
+typedef struct
+{
+    char    **strings;
+    int     first[SC_HASHSIZE];
+    int     *next;
+} sc_hash_t;
+
+static sc_hash_t    schashes[SC_MAXHASHES];
+static int          numschashes;
+
 static void SC_ScriptError(void)
 {
-    char    *temp = commify(sc_Line);
+    char    *temp1 = commify(sc_Line);
+    char    *temp2 = commify(sc_Column);
 
-    C_Warning(1, "Line %s in the " BOLD("%s") " lump couldn't be parsed.",
-        temp, ScriptLumpName);
-    free(temp);
+    C_Warning(1, "Line %s, column %s in the " BOLD("%s") " lump couldn't be parsed.",
+        temp1, temp2, ScriptLumpName);
+    free(temp1);
+    free(temp2);
 }
 
 void SC_Open(const int lumpnum)
@@ -81,7 +103,9 @@ void SC_Open(const int lumpnum)
     ScriptBuffer = W_CacheLumpNum(ScriptLumpNum);
     ScriptPtr = ScriptBuffer;
     ScriptEndPtr = ScriptPtr + W_LumpLength(ScriptLumpNum);
+    ScriptLineStart = ScriptPtr;
     sc_Line = 1;
+    sc_Column = 1;
     sc_End = false;
     ScriptOpen = true;
     sc_String = StringBuffer;
@@ -128,7 +152,10 @@ bool SC_GetString(void)
             && (*ScriptPtr <= 32 || *ScriptPtr == '{' || *ScriptPtr == '='
                 || (*ScriptPtr == ',' && !SkipComma && *(ScriptPtr - 1) != '\'')))
             if (*ScriptPtr++ == '\n')
+            {
                 sc_Line++;
+                ScriptLineStart = ScriptPtr;
+            }
 
         if (ScriptPtr >= ScriptEndPtr)
         {
@@ -149,10 +176,12 @@ bool SC_GetString(void)
                 }
 
             sc_Line++;
+            ScriptLineStart = ScriptPtr;
         }
     }
 
     text = sc_String;
+    sc_Column = (int)(ScriptPtr - ScriptLineStart) + 1;
 
     if (*ScriptPtr == ASCII_QUOTE)
     {
@@ -235,8 +264,64 @@ void SC_UnGet(void)
     AlreadyGot = true;
 }
 
+static unsigned int SC_HashString(const char *string)
+{
+    unsigned int    hash = 0;
+
+    while (*string)
+        hash = hash * 31 + toupper(*string++);
+
+    return (hash & (SC_HASHSIZE - 1));
+}
+
+static sc_hash_t *SC_GetHash(char **strings)
+{
+    sc_hash_t   *hash;
+    int         count = 0;
+
+    for (int i = 0; i < numschashes; i++)
+        if (schashes[i].strings == strings)
+            return &schashes[i];
+
+    if (numschashes == SC_MAXHASHES)
+        return NULL;
+
+    hash = &schashes[numschashes++];
+    hash->strings = strings;
+
+    while (strings[count])
+        count++;
+
+    hash->next = I_Malloc(count * sizeof(*hash->next));
+
+    for (int i = 0; i < SC_HASHSIZE; i++)
+        hash->first[i] = -1;
+
+    // add them in reverse, so the first of any duplicates is the one matched
+    for (int i = count - 1; i >= 0; i--)
+    {
+        const unsigned int  key = SC_HashString(strings[i]);
+
+        hash->next[i] = hash->first[key];
+        hash->first[key] = i;
+    }
+
+    return hash;
+}
+
 int SC_MatchString(char **strings)
 {
+    const sc_hash_t *hash = SC_GetHash(strings);
+
+    if (hash)
+    {
+        for (int i = hash->first[SC_HashString(sc_String)]; i >= 0; i = hash->next[i])
+            if (SC_Compare(strings[i]))
+                return i;
+
+        return -1;
+    }
+
     for (int i = 0; *strings; i++)
         if (SC_Compare(*strings++))
             return i;
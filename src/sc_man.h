@@ -40,6 +40,7 @@
 extern char     *sc_String;
 extern float    sc_Number;
 extern int      sc_Line;
+extern int      sc_Column;
 
 void SC_Open(const int lumpnum);
 void SC_Close(void);
@@ -164,6 +164,18 @@ static bool             st_firsttime;
 // whether left-side main status bar is active
 static bool             st_statusbaron;
 
+// The status bar is kept here after it's drawn, along with the values of
+// everything drawn on it. Until one of those changes, it's copied back into
+// screens[0] rather than drawn again.
+#define ST_NUMSTATES        40
+
+static byte             stbarcache[MAXWIDTH * SBARHEIGHT];
+static int              stbarstate[ST_NUMSTATES];
+static bool             stbarcached;
+
+// which patch of each keybox is drawn when a key the player needs is flashing
+static int              flashingkeys[3] = { -1, -1, -1 };
+
 // main bar left
 static patch_t          *sbar;
 static patch_t          *sbar2;
@@ -1368,8 +1380,6 @@ static void ST_DoPaletteStuff(void)
 
 static void ST_DrawWidgets(bool refresh)
 {
-    static bool togglekey = true;
-
     STlib_UpdateBigAmmoNum(&w_ready);
 
     STlib_UpdateSmallAmmoNum(&w_ammo[am_clip], am_clip);
@@ -1413,6 +1423,27 @@ static void ST_DrawWidgets(bool refresh)
     STlib_UpdateMultIcon(&w_keyboxes[1], refresh);
     STlib_UpdateMultIcon(&w_keyboxes[2], refresh);
 
+    for (int i = 0; i < 3; i++)
+        if (flashingkeys[i] != -1)
+        {
+            const st_multicon_t *keybox = &w_keyboxes[i];
+
+            V_DrawPatch(keybox->x, keybox->y, 0, keybox->patch[flashingkeys[i]]);
+        }
+}
+
+//
+// ST_UpdateFlashingKeys
+// Work out which keys are flashing on the status bar.
+//
+static void ST_UpdateFlashingKeys(void)
+{
+    static bool togglekey = true;
+
+    flashingkeys[0] = -1;
+    flashingkeys[1] = -1;
+    flashingkeys[2] = -1;
+
     if (viewplayer->neededcardflash)
     {
         static bool showkey;
@@ -1442,28 +1473,14 @@ static void ST_DrawWidgets(bool refresh)
             {
                 for (int i = 0; i < NUMCARDS / 2; i++)
                     if (viewplayer->cards[i] <= 0 || viewplayer->cards[i + 3] <= 0)
-                    {
-                        const st_multicon_t *keybox = &w_keyboxes[i];
-
-                        V_DrawPatch(keybox->x, keybox->y, 0, keybox->patch[i + 6]);
-                    }
+                        flashingkeys[i] = i + 6;
             }
             else
             {
                 if (neededcard <= it_redcard)
-                {
-                    const st_multicon_t *keybox = &w_keyboxes[neededcard];
-
-                    V_DrawPatch(keybox->x, keybox->y, 0,
-                        keybox->patch[(viewplayer->cards[neededcard + 3] > 0 ? neededcard + 6 : neededcard)]);
-                }
+                    flashingkeys[neededcard] = (viewplayer->cards[neededcard + 3] > 0 ? neededcard + 6 : neededcard);
                 else
-                {
-                    const st_multicon_t *keybox = &w_keyboxes[neededcard - 3];
-
-                    V_DrawPatch(keybox->x, keybox->y, 0,
-                        keybox->patch[(viewplayer->cards[neededcard - 3] > 0 ? neededcard + 3 : neededcard)]);
-                }
+                    flashingkeys[neededcard - 3] = (viewplayer->cards[neededcard - 3] > 0 ? neededcard + 3 : neededcard);
             }
         }
     }
@@ -1471,6 +1488,58 @@ static void ST_DrawWidgets(bool refresh)
         togglekey = true;
 }
 
+//
+// ST_StatusBarChanged
+// Return whether the value of anything drawn on the status bar is different
+// from when it was last drawn.
+//
+static bool ST_StatusBarChanged(void)
+{
+    int state[ST_NUMSTATES];
+    int i = 0;
+
+    st_shotguns = (viewplayer->weaponowned[wp_shotgun] || viewplayer->weaponowned[wp_supershotgun]);
+
+    state[i++] = SCREENWIDTH;
+    state[i++] = r_detail;
+    state[i++] = vid_widescreen;
+    state[i++] = usesmallnums;
+    state[i++] = facebackcolor;
+    state[i++] = negativehealth;
+    state[i++] = *w_ready.num;
+    state[i++] = (animatedstats ? ammodiff[weaponinfo[viewplayer->readyweapon].ammotype] : 0);
+
+    for (int j = 0; j < NUMAMMO; j++)
+    {
+        state[i++] = *w_ammo[j].num + ammodiff[j];
+        state[i++] = *w_maxammo[j].num + maxammodiff[j];
+    }
+
+    state[i++] = *w_health.n.num + (animatedstats ? healthdiff : 0);
+    state[i++] = viewplayer->negativehealth + (animatedstats ? healthdiff : 0);
+    state[i++] = *w_armor.n.num + (animatedstats ? armordiff : 0);
+
+    for (int j = 0; j < (gamemode == shareware ? 4 : 6); j++)
+        state[i++] = *w_arms[j].inum;
+
+    state[i++] = *w_faces.inum;
+
+    for (int j = 0; j < 3; j++)
+    {
+        state[i++] = *w_keyboxes[j].inum;
+        state[i++] = flashingkeys[j];
+    }
+
+    while (i < ST_NUMSTATES)
+        state[i++] = 0;
+
+    if (stbarcached && !memcmp(state, stbarstate, sizeof(state)))
+        return false;
+
+    memcpy(stbarstate, state, sizeof(state));
+    return true;
+}
+
 static void ST_DoRefresh(void)
 {
     st_firsttime = false;
@@ -1501,12 +1570,26 @@ void ST_Drawer(bool fullscreen, bool refresh)
     st_statusbaron = !fullscreen;
     st_firsttime = (st_firsttime || refresh);
 
+    ST_UpdateFlashingKeys();
+
+    if (st_statusbaron && !ST_StatusBarChanged())
+    {
+        memcpy(&screens[0][(SCREENHEIGHT - SBARHEIGHT) * SCREENWIDTH], stbarcache, (size_t)SCREENWIDTH * SBARHEIGHT);
+        return;
+    }
+
     // If just after ST_Start(), refresh all
     if (st_firsttime)
         ST_DoRefresh();
     else
         // Otherwise, update as little as possible
         ST_DiffDraw();
+
+    if (st_statusbaron)
+    {
+        memcpy(stbarcache, &screens[0][(SCREENHEIGHT - SBARHEIGHT) * SCREENWIDTH], (size_t)SCREENWIDTH * SBARHEIGHT);
+        stbarcached = true;
+    }
 }
 
 void ST_InitStatBar(void)
@@ -1527,6 +1610,7 @@ void ST_InitStatBar(void)
 
     sbarwidth = SHORT(sbar->width);
     sbar2width = SHORT(sbar2->width);
+    stbarcached = false;
 
     sbar->leftoffset = 0;
     sbar->topoffset = 0;
@@ -1752,6 +1836,7 @@ static void ST_CreateWidgets(void)
 
 void ST_Start(void)
 {
+    stbarcached = false;
     ST_InitData();
     ST_CreateWidgets();
 }
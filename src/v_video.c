@@ -43,10 +43,12 @@
 #include "hu_lib.h"
 #include "i_colors.h"
 #include "i_swap.h"
+#include "i_video.h"
 #include "m_array.h"
 #include "m_config.h"
 #include "m_menu.h"
 #include "m_misc.h"
+#include "miniz/miniz.h"
 #include "p_setup.h"
 #include "r_draw.h"
 #include "v_video.h"
@@ -57,6 +59,7 @@
 byte    *screens[NUMSCREENS];
 int     lowpixelwidth;
 int     lowpixelheight;
+int     lowpixelscale;
 
 void (*postprocessfunc)(byte *, int, int, int, int, int, int, int);
 
@@ -1869,14 +1872,65 @@ static void V_LowGraphicDetail_2x2_Antialiased(byte *screen, int screenwidth,
         }
 }
 
+//
+// V_ScaleLowGraphicDetail
+// Blow up a view of lowwidth x lowheight pixels, drawn into the top-left corner
+// of its window, to fill all width x height pixels of that window in blocks of
+// scale x scale pixels. Each block is written from the bottom-right, so nothing
+// is overwritten before it is read.
+//
+void V_ScaleLowGraphicDetail(byte *screen, int screenwidth, int width, int height,
+    int lowwidth, int lowheight, int scale, bool antialiased)
+{
+    if (antialiased)
+        for (int y = 0; y < lowheight; y++)
+        {
+            byte        *dot = screen + y * screenwidth;
+            const int   down = (y < lowheight - 1 ? screenwidth : 0);
+
+            for (int x = 0; x < lowwidth; x++, dot++)
+            {
+                const int   right = (x < lowwidth - 1);
+
+                *dot = tinttab50[(tinttab50[(*dot << 8) + *(dot + right)] << 8)
+                    + tinttab50[(*(dot + down) << 8) + *(dot + down + right)]];
+            }
+        }
+
+    for (int y = lowheight - 1; y >= 0; y--)
+    {
+        const byte  *source = screen + y * screenwidth;
+        byte        *dest = screen + y * scale * screenwidth;
+        const int   rows = (y == lowheight - 1 ? height - y * scale : scale);
+
+        for (int x = lowwidth - 1, right = width; x >= 0; x--)
+        {
+            const byte  color = source[x];
+
+            for (int xx = x * scale; xx < right; xx++)
+                dest[xx] = color;
+
+            right = x * scale;
+        }
+
+        for (int yy = 1; yy < rows; yy++)
+            memcpy(dest + yy * screenwidth, dest, width);
+    }
+}
+
 void GetPixelSize(void)
 {
     int width = -1;
     int height = -1;
 
+    lowpixelscale = 1;
+
     if (sscanf(r_lowpixelsize, "%2ix%2i", &width, &height) == 2
         && ((width >= 2 && height >= 1) || (width >= 1 && height >= 2)))
     {
+        if (width == height)
+            lowpixelscale = width;
+
         if (width == 2 && height == 2)
             postprocessfunc = (r_antialiasing ? &V_LowGraphicDetail_2x2_Antialiased : &V_LowGraphicDetail_2x2);
         else
@@ -1891,6 +1945,8 @@ void GetPixelSize(void)
         r_lowpixelsize = r_lowpixelsize_default;
         M_SaveCVARs();
 
+        lowpixelscale = 2;
+
         postprocessfunc = (r_antialiasing ? &V_LowGraphicDetail_2x2_Antialiased : &V_LowGraphicDetail_2x2);
     }
 }
@@ -1934,29 +1990,357 @@ char        lbmpath1[MAX_PATH];
 static char lbmname2[MAX_PATH];
 char        lbmpath2[MAX_PATH] = "";
 
-static bool V_SavePNG(SDL_Window *sdlwindow, const char *path)
+//
+// Screenshots and captured frames are queued here, and then expanded to RGB,
+// compressed and written to disk by a separate thread so the game isn't held up.
+//
+#define SCREENSHOTQUEUESIZE 32
+
+typedef struct
+{
+    char        path[MAX_PATH];
+    byte        *pixels;
+    byte        palette[768];
+    bool        paletted;
+    int         width;
+    int         height;
+    int         compression;
+    FILE        *stream;
+} screenshot_t;
+
+static screenshot_t screenshotqueue[SCREENSHOTQUEUESIZE];
+static int          screenshotqueuehead;
+static int          numqueuedscreenshots;
+static bool         stopscreenshotthread;
+static SDL_mutex    *screenshotmutex;
+static SDL_cond     *screenshotcond;
+static SDL_Thread   *screenshotthread;
+static SDL_atomic_t failedscreenshots;
+
+bool                capturing = false;
+bool                capturingraw;
+static int          capturedframes;
+static FILE         *capturestream;
+static char         capturepath[MAX_PATH];
+
+static bool V_WriteScreenShot(screenshot_t *screenshot)
+{
+    const int   size = screenshot->width * screenshot->height;
+    byte        *rgb = screenshot->pixels;
+    bool        result = false;
+
+    if (screenshot->paletted && !(rgb = malloc((size_t)size * 3)))
+        return false;
+
+    if (screenshot->paletted)
+        for (int i = 0; i < size; i++)
+        {
+            const byte  *color = &screenshot->palette[screenshot->pixels[i] * 3];
+
+            rgb[i * 3] = color[0];
+            rgb[i * 3 + 1] = color[1];
+            rgb[i * 3 + 2] = color[2];
+        }
+
+    if (screenshot->stream)
+        result = (fwrite(rgb, 3, size, screenshot->stream) == (size_t)size);
+    else
+    {
+        size_t  length;
+        void    *png = tdefl_write_image_to_png_file_in_memory_ex(rgb, screenshot->width,
+                    screenshot->height, 3, &length, screenshot->compression, MZ_FALSE);
+
+        if (png)
+        {
+            FILE    *file = fopen(screenshot->path, "wb");
+
+            if (file)
+            {
+                result = (fwrite(png, 1, length, file) == length);
+
+                if (fclose(file))
+                    result = false;
+            }
+
+            mz_free(png);
+        }
+    }
+
+    if (rgb != screenshot->pixels)
+        free(rgb);
+
+    return result;
+}
+
+static int SDLCALL V_ScreenShotThread(void *data)
+{
+    while (true)
+    {
+        screenshot_t    *screenshot;
+
+        SDL_LockMutex(screenshotmutex);
+
+        while (!numqueuedscreenshots && !stopscreenshotthread)
+            SDL_CondWait(screenshotcond, screenshotmutex);
+
+        if (!numqueuedscreenshots)
+        {
+            SDL_UnlockMutex(screenshotmutex);
+            break;
+        }
+
+        // the slot isn't released until it has been written, so it can't be reused meanwhile
+        screenshot = &screenshotqueue[screenshotqueuehead];
+        SDL_UnlockMutex(screenshotmutex);
+
+        if (!V_WriteScreenShot(screenshot))
+            SDL_AtomicIncRef(&failedscreenshots);
+
+        free(screenshot->pixels);
+
+        SDL_LockMutex(screenshotmutex);
+        screenshotqueuehead = (screenshotqueuehead + 1) % SCREENSHOTQUEUESIZE;
+        numqueuedscreenshots--;
+        SDL_CondBroadcast(screenshotcond);
+        SDL_UnlockMutex(screenshotmutex);
+    }
+
+    return 0;
+}
+
+//
+// V_QueueScreenShot
+// Pass a screenshot, or a captured frame, on to the thread that writes them.
+// If the queue is full, wait for a slot rather than dropping it.
+//
+static bool V_QueueScreenShot(const screenshot_t *screenshot)
+{
+    if (!screenshotthread)
+    {
+        if (!screenshotmutex && !(screenshotmutex = SDL_CreateMutex()))
+            return false;
+
+        if (!screenshotcond && !(screenshotcond = SDL_CreateCond()))
+            return false;
+
+        stopscreenshotthread = false;
+
+        if (!(screenshotthread = SDL_CreateThread(V_ScreenShotThread, "Screenshots", NULL)))
+            return false;
+    }
+
+    SDL_LockMutex(screenshotmutex);
+
+    while (numqueuedscreenshots == SCREENSHOTQUEUESIZE)
+        SDL_CondWait(screenshotcond, screenshotmutex);
+
+    screenshotqueue[(screenshotqueuehead + numqueuedscreenshots) % SCREENSHOTQUEUESIZE] = *screenshot;
+    numqueuedscreenshots++;
+    SDL_CondBroadcast(screenshotcond);
+    SDL_UnlockMutex(screenshotmutex);
+
+    return true;
+}
+
+static bool V_ScreenShotQueued(const char *path)
 {
     bool    result = false;
-    int     width = 0;
-    int     height = 0;
+
+    if (!screenshotthread)
+        return false;
+
+    SDL_LockMutex(screenshotmutex);
+
+    for (int i = 0; i < numqueuedscreenshots && !result; i++)
+        result = M_StringCompare(screenshotqueue[(screenshotqueuehead + i) % SCREENSHOTQUEUESIZE].path, path);
+
+    SDL_UnlockMutex(screenshotmutex);
+
+    return result;
+}
+
+//
+// V_FlushScreenShots
+// Wait until everything that has been queued has been written.
+//
+static void V_FlushScreenShots(void)
+{
+    if (!screenshotthread)
+        return;
+
+    SDL_LockMutex(screenshotmutex);
+
+    while (numqueuedscreenshots)
+        SDL_CondWait(screenshotcond, screenshotmutex);
+
+    SDL_UnlockMutex(screenshotmutex);
+}
+
+static bool V_SavePNG(SDL_Window *sdlwindow, const char *path)
+{
+    int width = 0;
+    int height = 0;
 
     SDL_GetWindowSize(sdlwindow, &width, &height);
 
     if (width > 0 && height > 0)
     {
-        SDL_Surface *screenshot = SDL_CreateRGBSurface(0, (vid_widescreen ? width : height * 4 / 3),
-                        height, 32, 0, 0, 0, 0);
+        screenshot_t    screenshot = { 0 };
+
+        screenshot.width = (vid_widescreen ? width : height * 4 / 3);
+        screenshot.height = height;
+        screenshot.compression = vid_screenshotcompression;
+        M_StringCopy(screenshot.path, path, sizeof(screenshot.path));
+
+        // reading back the frame has to be done here, but the rest is left to the other thread
+        if (!(screenshot.pixels = malloc((size_t)screenshot.width * height * 3)))
+            return false;
+
+        if (!SDL_RenderReadPixels(SDL_GetRenderer(sdlwindow), NULL, SDL_PIXELFORMAT_RGB24,
+            screenshot.pixels, screenshot.width * 3) && V_QueueScreenShot(&screenshot))
+            return true;
+
+        free(screenshot.pixels);
+    }
+
+    return false;
+}
+
+//
+// V_StartCapture
+// Start capturing every frame, either as numbered PNG files or as a single stream of raw
+// 24-bit RGB frames, to the screenshots folder.
+//
+bool V_StartCapture(const bool raw)
+{
+    int count = 0;
+
+    if (capturing)
+        return false;
+
+    do
+    {
+        char    *temp = commify(++count);
+
+        if (raw)
+            M_snprintf(capturepath, sizeof(capturepath), "%sCapture%s%s%s.rgb", screenshotfolder,
+                (count == 1 ? "" : " ("), (count == 1 ? "" : temp), (count == 1 ? "" : ")"));
+        else
+            M_snprintf(capturepath, sizeof(capturepath), "%sCapture%s%s%s 00001.png", screenshotfolder,
+                (count == 1 ? "" : " ("), (count == 1 ? "" : temp), (count == 1 ? "" : ")"));
+
+        free(temp);
+    } while (M_FileExists(capturepath));
+
+    if (raw)
+    {
+        if (!(capturestream = fopen(capturepath, "wb")))
+            return false;
+    }
+    else
+        capturepath[strlen(capturepath) - 10] = '\0';
 
-        if (screenshot)
+    capturing = true;
+    capturingraw = raw;
+    capturedframes = 0;
+
+    return true;
+}
+
+//
+// V_StopCapture
+// Stop capturing, returning how many frames were captured.
+//
+int V_StopCapture(void)
+{
+    if (!capturing)
+        return 0;
+
+    V_FlushScreenShots();
+
+    if (capturestream)
+    {
+        fclose(capturestream);
+        capturestream = NULL;
+    }
+
+    capturing = false;
+
+    return capturedframes;
+}
+
+const char *V_CapturePath(void)
+{
+    return capturepath;
+}
+
+//
+// V_UpdateCapture
+// Called once every frame after it has been blitted, to queue it if it's being captured
+// and to report anything the screenshot thread couldn't write.
+//
+void V_UpdateCapture(void)
+{
+    int failed;
+
+    if (capturing)
+    {
+        screenshot_t    screenshot = { 0 };
+
+        screenshot.width = SCREENWIDTH;
+        screenshot.height = SCREENHEIGHT;
+        screenshot.paletted = true;
+        screenshot.compression = vid_screenshotcompression;
+        screenshot.stream = capturestream;
+
+        if (!capturingraw)
+            M_snprintf(screenshot.path, sizeof(screenshot.path), "%s %05i.png", capturepath, capturedframes + 1);
+
+        if ((screenshot.pixels = malloc(SCREENAREA)))
         {
-            if (!SDL_RenderReadPixels(SDL_GetRenderer(sdlwindow), NULL, 0, screenshot->pixels, screenshot->pitch))
-                result = !IMG_SavePNG(screenshot, path);
+            memcpy(screenshot.pixels, screens[0], SCREENAREA);
+            I_GetPalette(screenshot.palette);
 
-            SDL_FreeSurface(screenshot);
+            if (V_QueueScreenShot(&screenshot))
+                capturedframes++;
+            else
+                free(screenshot.pixels);
         }
     }
 
-    return result;
+    if ((failed = SDL_AtomicSet(&failedscreenshots, 0)))
+    {
+        char    *temp = commify(failed);
+
+        C_Warning(0, "%s screenshot%s couldn't be saved.", temp, (failed == 1 ? "" : "s"));
+        free(temp);
+
+        if (capturing)
+        {
+            V_StopCapture();
+            C_Warning(0, "Capturing has stopped.");
+        }
+    }
+}
+
+//
+// V_ShutdownScreenShots
+// Write out anything still queued before quitting.
+//
+void V_ShutdownScreenShots(void)
+{
+    V_StopCapture();
+
+    if (screenshotthread)
+    {
+        SDL_LockMutex(screenshotmutex);
+        stopscreenshotthread = true;
+        SDL_CondBroadcast(screenshotcond);
+        SDL_UnlockMutex(screenshotmutex);
+
+        SDL_WaitThread(screenshotthread, NULL);
+        screenshotthread = NULL;
+    }
 }
 
 bool V_ScreenShot(void)
@@ -2029,7 +2413,7 @@ bool V_ScreenShot(void)
 
         count++;
         M_snprintf(lbmpath1, sizeof(lbmpath1), "%s%s", screenshotfolder, lbmname1);
-    } while (M_FileExists(lbmpath1));
+    } while (M_FileExists(lbmpath1) || V_ScreenShotQueued(lbmpath1));
 
     free(temp1);
 
@@ -2050,7 +2434,7 @@ bool V_ScreenShot(void)
 
             count++;
             M_snprintf(lbmpath2, sizeof(lbmpath2), "%s%s", screenshotfolder, lbmname2);
-        } while (M_FileExists(lbmpath2));
+        } while (M_FileExists(lbmpath2) || V_ScreenShotQueued(lbmpath2));
 
         V_SavePNG(mapwindow, lbmpath2);
     }
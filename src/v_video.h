@@ -55,6 +55,10 @@ extern byte *screens[NUMSCREENS];
 
 extern int  lowpixelwidth;
 extern int  lowpixelheight;
+extern int  lowpixelscale;
+
+extern bool capturing;
+extern bool capturingraw;
 
 extern void (*postprocessfunc)(byte *, int, int, int, int, int, int, int);
 
@@ -124,10 +128,17 @@ void V_DrawPixel(int x, int y, byte color, bool highlight, bool shadow);
 void V_LowGraphicDetail_2x2(byte *screen, int screenwidth, int left, int top,
     int width, int height, int pixelwidth, int pixelheight);
 
+void V_ScaleLowGraphicDetail(byte *screen, int screenwidth, int width, int height,
+    int lowwidth, int lowheight, int scale, bool antialiased);
 void GetPixelSize(void);
 void V_InvertScreen(void);
 
 bool V_ScreenShot(void);
+bool V_StartCapture(const bool raw);
+int V_StopCapture(void);
+const char *V_CapturePath(void);
+void V_UpdateCapture(void);
+void V_ShutdownScreenShots(void);
 
 struct patch_s *V_LinearToTransPatch(const byte *data, int width, int height,
     int color_key);
@@ -48,6 +48,7 @@
 #include "i_swap.h"
 #include "i_system.h"
 #include "m_argv.h"
+#include "m_config.h"
 #include "m_misc.h"
 #include "version.h"
 #include "w_merge.h"
@@ -88,6 +89,15 @@ char                *wadsloaded;
 static int          numwads;
 static wadfile_t    *wadlist[MAXWADS];
 
+// released lumps, from least to most recently used
+static lumpinfo_t   *lruhead;
+static lumpinfo_t   *lrutail;
+static size_t       lrubytes;
+
+int64_t             lumpcachehits;
+int64_t             lumpcachemisses;
+int64_t             lumpcacheevictions;
+
 static bool IsFreedoom(const char *iwadname)
 {
     FILE        *fp = fopen(iwadname, "rb");
@@ -202,42 +212,6 @@ char *GetCorrectCase(char *path)
 }
 
 #if defined(_WIN32)
-static int LevenshteinDistance(const char *string1, const char *string2)
-{
-    const size_t    length1 = strlen(string1);
-    const size_t    length2 = strlen(string2);
-    int             result = INT_MAX;
-
-    if (length1 > 0 && length2 > 0)
-    {
-        int *column = malloc((length1 + 1) * sizeof(int));
-
-        if (column)
-        {
-            for (int y = 1; (size_t)y <= length1; y++)
-                column[y] = y;
-
-            for (int x = 1; (size_t)x <= length2; x++)
-            {
-                column[0] = x;
-
-                for (int y = 1, lastdiagonal = x - 1, olddiagonal; (size_t)y <= length1; y++)
-                {
-                    olddiagonal = column[y];
-                    column[y] = MIN(MIN(column[y], column[y - 1]) + 1,
-                        lastdiagonal + (string1[y - 1] != string2[x - 1]));
-                    lastdiagonal = olddiagonal;
-                }
-            }
-
-            result = column[length1];
-            free(column);
-        }
-    }
-
-    return result;
-}
-
 char *W_GuessFilename(char *path, const char *string)
 {
     WIN32_FIND_DATA FindFileData;
@@ -260,7 +234,7 @@ char *W_GuessFilename(char *path, const char *string)
         if (!(FindFileData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
         {
             char    *string2 = removeext(FindFileData.cFileName);
-            int     distance = LevenshteinDistance(string1, string2);
+            int     distance = M_LevenshteinDistance(string1, string2);
 
             if (distance <= 2 && distance < bestdistance)
             {
@@ -875,30 +849,13 @@ void W_Init(void)
     }
 }
 
-static bool W_IsPNGLump(const int lump)
-{
-    bool    result = false;
-
-    if (W_LumpLength(lump) >= 13)
-    {
-        const unsigned char *patch = (const unsigned char *)W_CacheLumpNum(lump);
-
-        if (patch[0] == 0x89 && patch[1] == 'P' && patch[2] == 'N' && patch[3] == 'G')
-            result = true;
-
-        W_ReleaseLumpNum(lump);
-    }
-
-    return result;
-}
-
 void W_CheckForPNGLumps(void)
 {
-    if (W_IsPNGLump(W_GetNumForName("TITLEPIC")))
+    if (W_LumpFormat(W_GetNumForName("TITLEPIC")) == LUMP_PNG)
         I_Error("The TITLEPIC lump is an unsupported PNG image!");
 
     for (int i = 0; i < numlumps; i++)
-        if (W_IsPNGLump(i))
+        if (W_LumpFormat(i) == LUMP_PNG)
             C_Warning(0, "The " BOLD("%.8s") " lump is an unsupported PNG image.",
                 lumpinfo[i]->name);
 }
@@ -990,19 +947,176 @@ static void W_ReadLump(int lump, void *dest)
         I_Error("W_ReadLump: only read %zd of %i on lump %i", c, l->size, lump);
 }
 
+//
+// W_PeekLump
+// Reads no more than the first length bytes of a lump into dest,
+//  without caching the rest of it. Returns the number of bytes read.
+//
+int W_PeekLump(int lump, void *dest, int length)
+{
+    const lumpinfo_t    *l = lumpinfo[lump];
+
+    if ((length = MIN(length, l->size)) <= 0)
+        return 0;
+
+    if (l->cache)
+    {
+        memcpy(dest, l->cache, length);
+        return length;
+    }
+
+    return (int)W_Read(l->wadfile, l->position, dest, length);
+}
+
+//
+// W_LumpFormat
+// Identifies a lump from the magic bytes at its start. The result is
+//  kept in lumpinfo_t so that each lump is only ever looked at once.
+//
+lumpformat_t W_LumpFormat(int lump)
+{
+    lumpinfo_t  *l = lumpinfo[lump];
+
+    if (l->format == LUMP_UNSCANNED)
+    {
+        byte        header[16] = { 0 };
+        const int   length = W_PeekLump(lump, header, sizeof(header));
+
+        if (length >= 13 && header[0] == 0x89 && !memcmp(header + 1, "PNG", 3))
+            l->format = LUMP_PNG;
+        else if (length >= 16 && !memcmp(header, "RIFF", 4) && !memcmp(header + 8, "WAVEfmt ", 8))
+            l->format = LUMP_WAV;
+        else if (length >= 14 && !memcmp(header, "MUS\x1A", 4))
+            l->format = LUMP_MUS;
+        else if (length >= 14 && !memcmp(header, "MThd", 4))
+            l->format = LUMP_MIDI;
+        else if (length >= 4 && !memcmp(header, "OggS", 4))
+            l->format = LUMP_OGG;
+        else if (length >= 4 && !memcmp(header, "fLaC", 4))
+            l->format = LUMP_FLAC;
+        else if (length >= 3 && (!memcmp(header, "ID3", 3) || (header[0] == 0xFF && (header[1] & 0xE0) == 0xE0)))
+            l->format = LUMP_MP3;
+        else if (length >= 8 && header[0] == 0x03 && header[1] == 0x00)
+            l->format = LUMP_DMX;
+        else
+            l->format = LUMP_UNKNOWN;
+    }
+
+    return l->format;
+}
+
+//
+// Lump cache
+// A lump is cached as PU_STATIC for as long as it's in use. Once it has
+// been released as many times as it has been cached, it's added to the
+// end of an LRU list and made purgeable. The least recently used lumps
+// are then freed a few at a time whenever the list grows beyond
+// mem_cachebudget MB.
+//
+#define MAXEVICTIONS    16
+
+static void W_UnlinkLRU(lumpinfo_t *lump)
+{
+    if (lump->lruprev)
+        lump->lruprev->lrunext = lump->lrunext;
+    else
+        lruhead = lump->lrunext;
+
+    if (lump->lrunext)
+        lump->lrunext->lruprev = lump->lruprev;
+    else
+        lrutail = lump->lruprev;
+
+    lump->lruprev = NULL;
+    lump->lrunext = NULL;
+    lump->inlru = false;
+    lrubytes -= lump->size;
+}
+
+static void W_LinkLRU(lumpinfo_t *lump)
+{
+    lump->lruprev = lrutail;
+    lump->lrunext = NULL;
+
+    if (lrutail)
+        lrutail->lrunext = lump;
+    else
+        lruhead = lump;
+
+    lrutail = lump;
+    lump->inlru = true;
+    lrubytes += lump->size;
+}
+
+static void W_TrimLumpCache(void)
+{
+    const size_t    budget = (size_t)mem_cachebudget * 1024 * 1024;
+
+    for (int i = 0; i < MAXEVICTIONS && lrubytes > budget; i++)
+    {
+        lumpinfo_t  *lump = lruhead;
+
+        W_UnlinkLRU(lump);
+
+        if (lump->cache)
+        {
+            Z_Free(lump->cache);
+            lumpcacheevictions++;
+        }
+    }
+}
+
 void *W_CacheLumpNum(int lumpnum)
 {
     lumpinfo_t  *lump = lumpinfo[lumpnum];
 
-    if (!lump->cache)
-        W_ReadLump(lumpnum, Z_Malloc(lump->size, PU_CACHE, &lump->cache));
+    if (lump->inlru)
+    {
+        W_UnlinkLRU(lump);
+        Z_ChangeTag(lump->cache, PU_STATIC);
+    }
+
+    if (lump->cache)
+        lumpcachehits++;
+    else
+    {
+        lumpcachemisses++;
+        W_TrimLumpCache();
+        W_ReadLump(lumpnum, Z_Malloc(lump->size, PU_STATIC, &lump->cache));
+    }
+
+    if (lump->locks < INT_MAX)
+        lump->locks++;
 
     return lump->cache;
 }
 
 void W_ReleaseLumpNum(int lumpnum)
 {
-    Z_ChangeTag(lumpinfo[lumpnum]->cache, PU_CACHE);
+    lumpinfo_t  *lump = lumpinfo[lumpnum];
+
+    // a lump cached more than INT_MAX times stays locked
+    if (!lump->locks || lump->locks == INT_MAX)
+        return;
+
+    if (!--lump->locks && lump->cache)
+    {
+        Z_ChangeTag(lump->cache, PU_CACHE);
+        W_LinkLRU(lump);
+        W_TrimLumpCache();
+    }
+}
+
+size_t W_LumpCacheSize(size_t *released)
+{
+    size_t  size = 0;
+
+    for (int i = 0; i < numlumps; i++)
+        if (lumpinfo[i]->cache)
+            size += lumpinfo[i]->size;
+
+    *released = lrubytes;
+    return size;
 }
 
 void W_CloseFiles(void)
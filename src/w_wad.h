@@ -49,25 +49,52 @@
 #define IWAD    1
 #define PWAD    2
 
- typedef struct
+typedef enum
 {
-    char        name[9];
-    int         size;
-    void        *cache;
+    LUMP_UNSCANNED,
+    LUMP_UNKNOWN,
+    LUMP_PNG,
+    LUMP_DMX,
+    LUMP_WAV,
+    LUMP_MUS,
+    LUMP_MIDI,
+    LUMP_OGG,
+    LUMP_MP3,
+    LUMP_FLAC
+} lumpformat_t;
+
+typedef struct lumpinfo_s
+{
+    char                name[9];
+    int                 size;
+    void                *cache;
+    lumpformat_t        format;
+
+    // number of W_CacheLumpNum() calls not yet matched by W_ReleaseLumpNum()
+    int                 locks;
+
+    // neighbors in the LRU list of released lumps
+    bool                inlru;
+    struct lumpinfo_s   *lruprev;
+    struct lumpinfo_s   *lrunext;
 
     // killough 01/31/98: hash table fields, used for ultra-fast hash table lookup
-    int         index;
-    int         next;
+    int                 index;
+    int                 next;
 
-    int         position;
+    int                 position;
 
-    wadfile_t   *wadfile;
+    wadfile_t           *wadfile;
 } lumpinfo_t;
 
 extern lumpinfo_t   **lumpinfo;
 extern int          numlumps;
 extern char         *wadsloaded;
 
+extern int64_t      lumpcachehits;
+extern int64_t      lumpcachemisses;
+extern int64_t      lumpcacheevictions;
+
 bool IsUltimateDOOM(const char *iwadname);
 
 char *GetCorrectCase(char *path);
@@ -92,6 +119,8 @@ int W_GetNumForNameFromResourceWAD(const char *name);
 int W_GetNumLumps(const char *name);
 
 int W_LumpLength(int lump);
+int W_PeekLump(int lump, void *dest, int length);
+lumpformat_t W_LumpFormat(int lump);
 
 void *W_CacheLumpNum(int lumpnum);
 
@@ -106,6 +135,7 @@ void W_CheckForPNGLumps(void);
 unsigned int W_LumpNameHash(const char *s);
 
 void W_ReleaseLumpNum(int lumpnum);
+size_t W_LumpCacheSize(size_t *released);
 
 #define W_ReleaseLumpName(name)     W_ReleaseLumpNum(W_GetNumForName(name))
 
@@ -34,6 +34,7 @@
 */
 
 #include "i_system.h"
+#include "m_fixed.h"
 #include "z_zone.h"
 
 // Minimum chunk size at which blocks are allocated
@@ -45,6 +46,8 @@ typedef struct memblock_s
     struct memblock_s   *prev;
     size_t              size;
     void                **user;
+    unsigned int        requested;
+    unsigned short      site;
     unsigned char       tag;
 } memblock_t;
 
@@ -54,6 +57,69 @@ static const size_t headersize = ((sizeof(memblock_t) + CHUNK_SIZE - 1) & ~(CHUN
 
 static memblock_t   *blockbytag[PU_MAX];
 
+zonetagstats_t      zonetagstats[PU_MAX];
+zonesite_t          zonesites[MAXZONESITES];
+int                 numzonesites;
+
+#define SITEHASHSIZE    (MAXZONESITES * 2)
+
+static short        sitehash[SITEHASHSIZE];
+
+//
+// Z_GetSite
+// Returns the index into zonesites[] of a file and line, adding it if it's
+// not there already. Sites past MAXZONESITES are all counted in the last one.
+//
+static unsigned short Z_GetSite(const char *file, const int line)
+{
+    unsigned int    i = (unsigned int)(((uintptr_t)file >> 3) ^ (line * 2654435761u)) % SITEHASHSIZE;
+    zonesite_t      *site;
+
+    while (sitehash[i])
+    {
+        site = &zonesites[sitehash[i] - 1];
+
+        if (site->line == line && site->file == file)
+            return (sitehash[i] - 1);
+
+        i = (i + 1) % SITEHASHSIZE;
+    }
+
+    if (numzonesites >= MAXZONESITES - 1)
+    {
+        if (numzonesites == MAXZONESITES - 1)
+            zonesites[numzonesites++].file = "(other)";
+
+        return (MAXZONESITES - 1);
+    }
+
+    site = &zonesites[numzonesites];
+    site->file = file;
+    site->line = line;
+    sitehash[i] = ++numzonesites;
+
+    return (numzonesites - 1);
+}
+
+static void Z_AddStats(const memblock_t *block)
+{
+    zonetagstats_t  *stats = &zonetagstats[block->tag];
+
+    stats->blocks++;
+    stats->bytes += block->size;
+    stats->overhead += headersize + block->size - block->requested;
+    stats->peakbytes = MAX(stats->peakbytes, stats->bytes);
+}
+
+static void Z_RemoveStats(const memblock_t *block)
+{
+    zonetagstats_t  *stats = &zonetagstats[block->tag];
+
+    stats->blocks--;
+    stats->bytes -= block->size;
+    stats->overhead -= headersize + block->size - block->requested;
+}
+
 //
 // Z_Malloc
 // You can pass a NULL user if the tag is < PU_PURGELEVEL.
@@ -66,9 +132,10 @@ static memblock_t   *blockbytag[PU_MAX];
 // but we only free the blocks we actually end up using; we don't
 // free all the stuff we just pass on the way.
 //
-void *Z_Malloc(size_t size, unsigned char tag, void **user)
+void *Z_MallocAt(size_t size, unsigned char tag, void **user, const char *file, const int line)
 {
-    memblock_t  *block = NULL;
+    memblock_t          *block = NULL;
+    const unsigned int  requested = (unsigned int)size;
 
     if (!size)
         return (user ? (*user = NULL) : NULL);              // malloc(0) returns NULL
@@ -97,9 +164,16 @@ void *Z_Malloc(size_t size, unsigned char tag, void **user)
     }
 
     block->size = size;
+    block->requested = requested;
 
     block->tag = tag;
     block->user = user;
+
+    block->site = Z_GetSite(file, line);
+    zonesites[block->site].blocks++;
+    zonesites[block->site].bytes += size;
+    zonesites[block->site].allocations++;
+    Z_AddStats(block);
     block = (memblock_t *)((char *)block + headersize);
 
     if (user)           // if there is a user
@@ -108,14 +182,14 @@ void *Z_Malloc(size_t size, unsigned char tag, void **user)
     return block;
 }
 
-void *Z_Calloc(size_t size1, size_t size2, unsigned char tag, void **user)
+void *Z_CallocAt(size_t size1, size_t size2, unsigned char tag, void **user, const char *file, const int line)
 {
-    return ((size1 *= size2) ? memset(Z_Malloc(size1, tag, user), 0, size1) : NULL);
+    return ((size1 *= size2) ? memset(Z_MallocAt(size1, tag, user, file, line), 0, size1) : NULL);
 }
 
-char *Z_StringDuplicate(const char *s, unsigned char tag, void **user)
+char *Z_StringDuplicateAt(const char *s, unsigned char tag, void **user, const char *file, const int line)
 {
-    char    *d = Z_Malloc(strlen(s) + 1, tag, user);
+    char    *d = Z_MallocAt(strlen(s) + 1, tag, user, file, line);
 
     if (d)
         strcpy(d, s);
@@ -136,6 +210,10 @@ void Z_Free(void *ptr)
     if (block->user)
         *block->user = NULL;
 
+    zonesites[block->site].blocks--;
+    zonesites[block->site].bytes -= block->size;
+    Z_RemoveStats(block);
+
     if (block == block->next)
         blockbytag[block->tag] = NULL;
     else if (blockbytag[block->tag] == block)
@@ -186,6 +264,8 @@ void Z_ChangeTag(void *ptr, unsigned char tag)
     if (tag == block->tag)
         return;
 
+    Z_RemoveStats(block);
+
     if (block == block->next)
         blockbytag[block->tag] = NULL;
     else if (blockbytag[block->tag] == block)
@@ -208,4 +288,5 @@ void Z_ChangeTag(void *ptr, unsigned char tag)
     }
 
     block->tag = tag;
+    Z_AddStats(block);
 }
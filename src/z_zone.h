@@ -57,9 +57,39 @@ enum
 
 #define PU_PURGELEVEL    PU_CACHE    // First purgeable tag's level
 
-void *Z_Malloc(size_t size, unsigned char tag, void **user) ALLOCATTR(1);
-void *Z_Calloc(size_t size1, size_t size2, unsigned char tag, void **user) ALLOCSATTR(1, 2);
-char *Z_StringDuplicate(const char *, unsigned char tag, void **user);
+// per-tag usage
+typedef struct
+{
+    int             blocks;
+    size_t          bytes;
+    size_t          peakbytes;
+    size_t          overhead;   // block headers and rounding
+} zonetagstats_t;
+
+// usage by each place Z_Malloc(), Z_Calloc() or Z_StringDuplicate() is called from
+typedef struct
+{
+    const char      *file;
+    int             line;
+    int             blocks;
+    size_t          bytes;
+    int             allocations;
+} zonesite_t;
+
+#define MAXZONESITES    1024
+
+extern zonetagstats_t   zonetagstats[PU_MAX];
+extern zonesite_t       zonesites[MAXZONESITES];
+extern int              numzonesites;
+
+void *Z_MallocAt(size_t size, unsigned char tag, void **user, const char *file, const int line) ALLOCATTR(1);
+void *Z_CallocAt(size_t size1, size_t size2, unsigned char tag, void **user, const char *file, const int line) ALLOCSATTR(1, 2);
+char *Z_StringDuplicateAt(const char *s, unsigned char tag, void **user, const char *file, const int line);
+
+#define Z_Malloc(size, tag, user)           Z_MallocAt(size, tag, user, __FILE__, __LINE__)
+#define Z_Calloc(size1, size2, tag, user)   Z_CallocAt(size1, size2, tag, user, __FILE__, __LINE__)
+#define Z_StringDuplicate(s, tag, user)     Z_StringDuplicateAt(s, tag, user, __FILE__, __LINE__)
+
 void Z_Free(void *ptr);
 void Z_FreeTags(unsigned char lowtag, unsigned char hightag);
 void Z_ChangeTag(void *ptr, unsigned char tag);